@@ -0,0 +1,1099 @@
+#include <algorithm>
+#include <vector>
+#include "modpoly.h"
+
+// ------------------------------ modpoly.cpp ---------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the ModPoly class that
+// represents a polynomial whose coefficients are integers modulo a prime. The
+// prime must support the number-theoretic transform, so the ModPoly class can
+// multiply two polynomials in O(n log n) time. On top of the fast
+// multiplication, the ModPoly class supports division with remainder,
+// multipoint evaluation, and interpolation through a subproduct tree.
+//
+// Note: The Poly class uses the ModPoly class over two primes and combines the
+// two results with the Chinese remainder theorem. The combined coefficient is
+// exact as long as the true coefficient fits in an int.
+// ----------------------------------------------------------------------------
+
+const unsigned ModPoly::PRIME_A;
+const unsigned ModPoly::PRIME_B;
+const int ModPoly::SCHOOLBOOK_LIMIT;
+const int ModPoly::MAX_TRANSFORM;
+const int ModPoly::LEAF_LIMIT;
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates a zero polynomial
+// modulo the given prime.
+//
+// Pre: The given modulus must be PRIME_A or PRIME_B.
+//
+// Post: A zero polynomial modulo the given prime exists.
+//
+// Parameter: modulus, which is the prime that the coefficients are reduced
+// by.
+ModPoly::ModPoly(unsigned modulus) : mod(modulus)
+{
+
+} // end of this parametrized constructor
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates a polynomial modulo the
+// given prime whose coefficients are the given residues.
+//
+// Pre: The given modulus must be PRIME_A or PRIME_B. Every residue must be
+// less than the modulus.
+//
+// Post: A polynomial whose coefficient of x^i is the i-th residue exists.
+//
+// Parameter: modulus, which is the prime that the coefficients are reduced
+// by.
+//
+// Parameter: coefficients, which are the residues in increasing power order.
+ModPoly::ModPoly(unsigned modulus, const std::vector<unsigned>& coefficients) :
+coeff(coefficients), mod(modulus)
+{
+    trim();
+} // end of this parametrized constructor
+
+// -------------------------------getDegree------------------------------------
+// Description: The method getDegree returns the degree of this polynomial.
+//
+// Post: This polynomial does not change.
+//
+// Return: The degree of this polynomial; -1 if this polynomial is zero.
+int ModPoly::getDegree() const
+{
+    return static_cast<int>(coeff.size()) - 1;
+} // end of the method getDegree
+
+// --------------------------------getCoeff------------------------------------
+// Description: The method getCoeff returns the residue of the given power.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: power, which is the power whose coefficient should be returned.
+//
+// Return: The coefficient of the given power; zero if the power is negative
+// or greater than the degree.
+unsigned ModPoly::getCoeff(int power) const
+{
+    if (power < 0 || power >= static_cast<int>(coeff.size()))
+    {
+        return 0;
+    }
+    return coeff[power];
+} // end of the method getCoeff
+
+// ------------------------------operator + -----------------------------------
+// Description: The method operator+ adds this polynomial and the polynomial
+// on the right hand side.
+//
+// Pre: Both polynomials must have the same modulus.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the addition.
+ModPoly ModPoly::operator+(const ModPoly& rhs) const
+{
+    ModPoly result(mod);
+    result.coeff.resize(std::max(coeff.size(), rhs.coeff.size()), 0);
+    for (size_t i = 0; i < result.coeff.size(); i++)
+    {
+        unsigned sum = (i < coeff.size() ? coeff[i] : 0) +
+                       (i < rhs.coeff.size() ? rhs.coeff[i] : 0);
+        result.coeff[i] = sum >= mod ? sum - mod : sum;
+    }
+    result.trim();
+    return result;
+} // end of the method operator+
+
+// ------------------------------operator - -----------------------------------
+// Description: The method operator- subtracts the polynomial on the right
+// hand side from this polynomial.
+//
+// Pre: Both polynomials must have the same modulus.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the subtraction.
+ModPoly ModPoly::operator-(const ModPoly& rhs) const
+{
+    ModPoly result(mod);
+    result.coeff.resize(std::max(coeff.size(), rhs.coeff.size()), 0);
+    for (size_t i = 0; i < result.coeff.size(); i++)
+    {
+        unsigned left = i < coeff.size() ? coeff[i] : 0;
+        unsigned right = i < rhs.coeff.size() ? rhs.coeff[i] : 0;
+        result.coeff[i] = left >= right ? left - right : left + mod - right;
+    }
+    result.trim();
+    return result;
+} // end of the method operator-
+
+// ------------------------------operator * -----------------------------------
+// Description: The method operator* multiplies this polynomial by the
+// polynomial on the right hand side. Short operands are multiplied by the
+// schoolbook method; longer operands go through the number-theoretic
+// transform.
+//
+// Pre: Both polynomials must have the same modulus.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the multiplication.
+ModPoly ModPoly::operator*(const ModPoly& rhs) const
+{
+    ModPoly result(mod);
+    result.coeff = multiplyVectors(coeff, rhs.coeff, mod);
+    result.trim();
+    return result;
+} // end of the method operator*
+
+// ------------------------------operator / -----------------------------------
+// Description: The method operator/ divides this polynomial by the polynomial
+// on the right hand side and returns the quotient.
+//
+// Pre: Both polynomials must have the same modulus. The divisor cannot be
+// zero.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, the divisor.
+//
+// Return: The quotient of the division.
+ModPoly ModPoly::operator/(const ModPoly& rhs) const
+{
+    int n = getDegree();
+    int m = rhs.getDegree();
+    ModPoly quotient(mod);
+    if (n < m || m < 0)
+    {
+        return quotient;
+    }
+
+    int terms = n - m + 1;
+    if (m < SCHOOLBOOK_LIMIT || terms < SCHOOLBOOK_LIMIT)
+    {
+        // Long division, which is faster when the divisor or the quotient is
+        // short.
+        std::vector<unsigned> rest(coeff);
+        unsigned leadInverse = power(rhs.coeff[m], mod - 2, mod);
+        quotient.coeff.assign(terms, 0);
+        for (int i = n; i >= m; i--)
+        {
+            unsigned long long factor = static_cast<unsigned long long>(rest[i]) * leadInverse % mod;
+            quotient.coeff[i - m] = static_cast<unsigned>(factor);
+            if (factor != 0)
+            {
+                for (int j = 0; j <= m; j++)
+                {
+                    unsigned product = static_cast<unsigned>(factor * rhs.coeff[j] % mod);
+                    unsigned& target = rest[i - m + j];
+                    target = target >= product ? target - product : target + mod - product;
+                }
+            }
+        }
+        quotient.trim();
+        return quotient;
+    }
+
+    // The reversed quotient is the reversed dividend times the inverse of the
+    // reversed divisor, modulo x^terms.
+    ModPoly reversedDividend(mod);
+    reversedDividend.coeff.assign(coeff.rbegin(), coeff.rbegin() + terms);
+    reversedDividend.trim();
+    ModPoly reversedDivisor(mod);
+    reversedDivisor.coeff.assign(rhs.coeff.rbegin(),
+                                 rhs.coeff.rbegin() + std::min(terms, m + 1));
+    reversedDivisor.trim();
+
+    quotient = reversedDividend * reversedDivisor.inverse(terms);
+    quotient.coeff.resize(terms, 0);
+    std::reverse(quotient.coeff.begin(), quotient.coeff.end());
+    quotient.trim();
+    return quotient;
+} // end of the method operator/
+
+// ------------------------------operator % -----------------------------------
+// Description: The method operator% divides this polynomial by the polynomial
+// on the right hand side and returns the remainder.
+//
+// Pre: Both polynomials must have the same modulus. The divisor cannot be
+// zero.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, the divisor.
+//
+// Return: The remainder of the division, whose degree is less than the degree
+// of the divisor.
+ModPoly ModPoly::operator%(const ModPoly& rhs) const
+{
+    if (getDegree() < rhs.getDegree())
+    {
+        return *this;
+    }
+    ModPoly remainder = *this - rhs * (*this / rhs);
+    return remainder;
+} // end of the method operator%
+
+// -------------------------------derivative-----------------------------------
+// Description: The method derivative returns the formal derivative of this
+// polynomial.
+//
+// Post: This polynomial does not change.
+//
+// Return: The derivative of this polynomial.
+ModPoly ModPoly::derivative() const
+{
+    ModPoly result(mod);
+    if (coeff.size() > 1)
+    {
+        result.coeff.resize(coeff.size() - 1);
+        for (size_t i = 1; i < coeff.size(); i++)
+        {
+            result.coeff[i - 1] = static_cast<unsigned>(
+                static_cast<unsigned long long>(coeff[i]) * (i % mod) % mod);
+        }
+        result.trim();
+    }
+    return result;
+} // end of the method derivative
+
+// --------------------------------inverse-------------------------------------
+// Description: The method inverse computes the power series inverse of this
+// polynomial modulo x^terms with Newton iteration.
+//
+// Pre: The constant term of this polynomial cannot be zero.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: terms, which is the number of terms of the inverse to compute.
+//
+// Return: A polynomial g of degree less than terms such that this polynomial
+// times g is 1 modulo x^terms.
+ModPoly ModPoly::inverse(int terms) const
+{
+    ModPoly result(mod);
+    result.coeff.push_back(power(coeff[0], mod - 2, mod));
+
+    // Each step doubles the number of correct terms: g = g * (2 - f * g).
+    for (int length = 1; length < terms; )
+    {
+        length = std::min(2 * length, terms);
+        ModPoly truncated(mod);
+        truncated.coeff.assign(coeff.begin(),
+                               coeff.begin() + std::min(static_cast<size_t>(length), coeff.size()));
+        truncated.trim();
+
+        ModPoly error = truncated * result;
+        error.coeff.resize(length, 0);
+        for (int i = 0; i < length; i++)
+        {
+            error.coeff[i] = error.coeff[i] == 0 ? 0 : mod - error.coeff[i];
+        }
+        error.coeff[0] = error.coeff[0] + 2 >= mod ? error.coeff[0] + 2 - mod : error.coeff[0] + 2;
+        error.trim();
+
+        result = result * error;
+        if (static_cast<int>(result.coeff.size()) > length)
+        {
+            result.coeff.resize(length);
+        }
+        result.trim();
+    }
+    return result;
+} // end of the method inverse
+
+// -------------------------------taylorShift----------------------------------
+// Description: The method taylorShift returns this polynomial with x
+// replaced by x + shift. It scales the coefficients by factorials and does
+// a single convolution, which takes O(n log n) time.
+//
+// Pre: The degree of this polynomial must be less than the modulus.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: shift, which is the residue to shift by.
+//
+// Return: The shifted polynomial.
+ModPoly ModPoly::taylorShift(unsigned shift) const
+{
+    int n = getDegree();
+    if (n <= 0 || shift == 0)
+    {
+        return *this;
+    }
+
+    std::vector<unsigned> factorial(n + 1);
+    std::vector<unsigned> inverseFactorial(n + 1);
+    factorial[0] = 1;
+    for (int i = 1; i <= n; i++)
+    {
+        factorial[i] = static_cast<unsigned>(static_cast<unsigned long long>(factorial[i - 1]) * i % mod);
+    }
+    inverseFactorial[n] = power(factorial[n], mod - 2, mod);
+    for (int i = n; i > 0; i--)
+    {
+        inverseFactorial[i - 1] = static_cast<unsigned>(
+            static_cast<unsigned long long>(inverseFactorial[i]) * i % mod);
+    }
+
+    // k! * b_k is the sum over i of (a_i * i!) * (shift^(i-k) / (i-k)!), which is
+    // entry n - k of the convolution of the first sequence reversed with the
+    // second.
+    std::vector<unsigned> scaled(n + 1);
+    std::vector<unsigned> powers(n + 1);
+    unsigned long long shiftPower = 1;
+    for (int i = 0; i <= n; i++)
+    {
+        scaled[n - i] = static_cast<unsigned>(static_cast<unsigned long long>(coeff[i]) * factorial[i] % mod);
+        powers[i] = static_cast<unsigned>(shiftPower * inverseFactorial[i] % mod);
+        shiftPower = shiftPower * shift % mod;
+    }
+
+    std::vector<unsigned> product = multiplyVectors(scaled, powers, mod);
+    ModPoly result(mod);
+    result.coeff.resize(n + 1);
+    for (int k = 0; k <= n; k++)
+    {
+        result.coeff[k] = static_cast<unsigned>(
+            static_cast<unsigned long long>(product[n - k]) * inverseFactorial[k] % mod);
+    }
+    result.trim();
+    return result;
+} // end of the method taylorShift
+
+// ---------------------------------compose------------------------------------
+// Description: The method compose returns this polynomial evaluated at the
+// given polynomial. It splits this polynomial into a low half and a high
+// half, so p(q) = low(q) + q^half * high(q), and reuses the powers q^(2^k)
+// at every level. This takes O(M(N) log n) time, where N is the degree of
+// the result and M is the cost of a multiplication.
+//
+// Pre: Both polynomials must have the same modulus.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: inner, which is the polynomial to substitute for x.
+//
+// Return: The composition of this polynomial and the given polynomial.
+ModPoly ModPoly::compose(const ModPoly& inner) const
+{
+    if (coeff.size() <= 1)
+    {
+        return *this;
+    }
+
+    std::vector<ModPoly> powers(1, inner);
+    int level = 1;
+    while ((static_cast<size_t>(1) << level) < coeff.size())
+    {
+        powers.push_back(powers.back() * powers.back());
+        level++;
+    }
+    return composeRange(powers, 0, level);
+} // end of the method compose
+
+// --------------------------------evaluate------------------------------------
+// Description: The method evaluate computes the value of this polynomial at
+// the given point by Horner's rule.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: x, which is the residue to evaluate at.
+//
+// Return: The value of this polynomial at x.
+unsigned ModPoly::evaluate(unsigned x) const
+{
+    unsigned long long value = 0;
+    for (size_t i = coeff.size(); i-- > 0; )
+    {
+        value = (value * x + coeff[i]) % mod;
+    }
+    return static_cast<unsigned>(value);
+} // end of the method evaluate
+
+// --------------------------------evaluate------------------------------------
+// Description: The method evaluate computes the values of this polynomial at
+// all the given points by descending a subproduct tree, which takes
+// O(n log^2 n) time.
+//
+// Pre: Every point must be less than the modulus.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: points, which are the residues to evaluate at.
+//
+// Return: The values of this polynomial at the points, in the same order.
+std::vector<unsigned> ModPoly::evaluate(const std::vector<unsigned>& points) const
+{
+    int n = static_cast<int>(points.size());
+    std::vector<unsigned> values(n, 0);
+    if (n > 0)
+    {
+        std::vector<ModPoly> tree(4 * n, ModPoly(mod));
+        buildTree(tree, points, 1, 0, n);
+        evaluateRoot(*this, tree, points, values);
+    }
+    return values;
+} // end of the method evaluate
+
+// ------------------------------interpolate-----------------------------------
+// Description: The method interpolate builds the polynomial of degree less
+// than n that passes through the given n points, using the subproduct tree.
+// This takes O(n log^2 n) time.
+//
+// Pre: The two vectors must have the same size, and every residue must be
+// less than the modulus. The x residues must be distinct.
+//
+// Post: The given result holds the interpolating polynomial. If two x
+// residues are the same, the result is zero and this method returns false.
+//
+// Parameter: x, which are the x residues of the points.
+//
+// Parameter: y, which are the y residues of the points.
+//
+// Parameter: result, which holds the interpolating polynomial.
+//
+// Return: True if the x residues are distinct; false otherwise.
+bool ModPoly::interpolate(const std::vector<unsigned>& x,
+                          const std::vector<unsigned>& y, ModPoly& result)
+{
+    unsigned modulus = result.mod;
+    int n = static_cast<int>(x.size());
+    result.coeff.clear();
+    if (n == 0)
+    {
+        return true;
+    }
+
+    // The root of the tree is M(x), the product of (x - x_i). The Lagrange
+    // basis polynomial of x_i is M(x) / (x - x_i) divided by M'(x_i).
+    std::vector<ModPoly> tree(4 * n, ModPoly(modulus));
+    buildTree(tree, x, 1, 0, n);
+    std::vector<unsigned> weights(n, 0);
+    evaluateRoot(tree[1].derivative(), tree, x, weights);
+
+    for (int i = 0; i < n; i++)
+    {
+        // M'(x_i) is zero exactly when x_i appears twice.
+        if (weights[i] == 0)
+        {
+            return false;
+        }
+        weights[i] = static_cast<unsigned>(static_cast<unsigned long long>(y[i]) *
+                                           power(weights[i], modulus - 2, modulus) % modulus);
+    }
+
+    result = combineTree(tree, weights, modulus, 1, 0, n);
+    return true;
+} // end of the method interpolate
+
+// ---------------------------interpolateNewton--------------------------------
+// Description: The method interpolateNewton builds the polynomial of degree
+// less than n that passes through the given n points, using Newton's divided
+// differences. This takes O(n^2) time with a small constant, so it is faster
+// than the subproduct tree for a small number of points.
+//
+// Pre: The two vectors must have the same size, and every residue must be
+// less than the modulus. The x residues must be distinct.
+//
+// Post: The given result holds the interpolating polynomial. If two x
+// residues are the same, the result is zero and this method returns false.
+//
+// Parameter: x, which are the x residues of the points.
+//
+// Parameter: y, which are the y residues of the points.
+//
+// Parameter: result, which holds the interpolating polynomial.
+//
+// Return: True if the x residues are distinct; false otherwise.
+bool ModPoly::interpolateNewton(const std::vector<unsigned>& x,
+                                const std::vector<unsigned>& y, ModPoly& result)
+{
+    unsigned modulus = result.mod;
+    int n = static_cast<int>(x.size());
+    result.coeff.clear();
+
+    // Compute the divided differences in place. After step k, entry i holds
+    // f[x_(i-k), ..., x_i]. The gaps of one step are inverted together, so each
+    // step needs one modular inverse instead of one per entry.
+    std::vector<unsigned> difference(y);
+    std::vector<unsigned> prefix(n, 1);
+    for (int k = 1; k < n; k++)
+    {
+        unsigned long long running = 1;
+        for (int i = k; i < n; i++)
+        {
+            unsigned gap = x[i] >= x[i - k] ? x[i] - x[i - k] : x[i] + modulus - x[i - k];
+            if (gap == 0)
+            {
+                return false;
+            }
+            prefix[i] = static_cast<unsigned>(running);
+            running = running * gap % modulus;
+        }
+
+        // Walk back, peeling one gap off the inverse of the running product
+        // at each entry.
+        unsigned long long inverse = power(static_cast<unsigned>(running), modulus - 2, modulus);
+        for (int i = n - 1; i >= k; i--)
+        {
+            unsigned gap = x[i] >= x[i - k] ? x[i] - x[i - k] : x[i] + modulus - x[i - k];
+            unsigned long long gapInverse = inverse * prefix[i] % modulus;
+            inverse = inverse * gap % modulus;
+
+            unsigned rise = difference[i] >= difference[i - 1] ?
+                            difference[i] - difference[i - 1] :
+                            difference[i] + modulus - difference[i - 1];
+            difference[i] = static_cast<unsigned>(rise * gapInverse % modulus);
+        }
+    }
+
+    // Expand the Newton form from the innermost term:
+    // p = d_0 + (x - x_0)(d_1 + (x - x_1)(d_2 + ...)).
+    std::vector<unsigned> expanded;
+    expanded.reserve(n);
+    if (n > 0)
+    {
+        expanded.push_back(difference[n - 1]);
+    }
+    for (int k = n - 2; k >= 0; k--)
+    {
+        // Multiply by (x - x_k) from the top down, then add d_k.
+        unsigned long long shift = x[k];
+        expanded.push_back(0);
+        for (size_t i = expanded.size() - 1; i > 0; i--)
+        {
+            unsigned product = static_cast<unsigned>(shift * expanded[i] % modulus);
+            unsigned value = expanded[i - 1];
+            expanded[i] = value >= product ? value - product : value + modulus - product;
+        }
+        unsigned product = static_cast<unsigned>(shift * expanded[0] % modulus);
+        expanded[0] = difference[k] >= product ? difference[k] - product :
+                      difference[k] + modulus - product;
+    }
+
+    result.coeff = expanded;
+    result.trim();
+    return true;
+} // end of the method interpolateNewton
+
+// ---------------------------------reduce-------------------------------------
+// Description: The method reduce maps an integer to its residue.
+//
+// Parameter: value, which is the integer to reduce.
+//
+// Parameter: modulus, which is the prime to reduce by.
+//
+// Return: The residue of the given value, between 0 and modulus - 1.
+unsigned ModPoly::reduce(long long value, unsigned modulus)
+{
+    long long residue = value % static_cast<long long>(modulus);
+    return static_cast<unsigned>(residue < 0 ? residue + modulus : residue);
+} // end of the method reduce
+
+// ---------------------------------combine------------------------------------
+// Description: The method combine uses the Chinese remainder theorem to
+// recover an integer from its residues modulo PRIME_A and PRIME_B.
+//
+// Pre: The integer to recover must fit in an int.
+//
+// Parameter: residueA, which is the residue modulo PRIME_A.
+//
+// Parameter: residueB, which is the residue modulo PRIME_B.
+//
+// Return: The integer whose residues are the given residues.
+int ModPoly::combine(unsigned residueA, unsigned residueB)
+{
+    // value = residueA + PRIME_A * k, where k makes value agree with residueB.
+    static const unsigned inverseA = power(PRIME_A % PRIME_B, PRIME_B - 2, PRIME_B);
+    unsigned gap = residueB >= residueA % PRIME_B ? residueB - residueA % PRIME_B :
+                   residueB + PRIME_B - residueA % PRIME_B;
+    unsigned long long k = static_cast<unsigned long long>(gap) * inverseA % PRIME_B;
+    unsigned long long value = residueA + k * PRIME_A;
+
+    // Pick the representative closest to zero.
+    const unsigned long long product = static_cast<unsigned long long>(PRIME_A) * PRIME_B;
+    long long centered = value > product / 2 ? static_cast<long long>(value - product) :
+                         static_cast<long long>(value);
+    return static_cast<int>(centered);
+} // end of the method combine
+
+// ---------------------------------trim---------------------------------------
+// Description: The method trim removes the zero coefficients at the end of
+// the coefficient vector.
+//
+// Post: The coefficient vector does not end with a zero.
+void ModPoly::trim()
+{
+    while (!coeff.empty() && coeff.back() == 0)
+    {
+        coeff.pop_back();
+    }
+} // end of the method trim
+
+// ---------------------------------power--------------------------------------
+// Description: The method power raises the given base to the given exponent.
+//
+// Return: base^exponent modulo the given modulus.
+unsigned ModPoly::power(unsigned base, unsigned long long exponent, unsigned modulus)
+{
+    unsigned long long result = 1;
+    unsigned long long factor = base % modulus;
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = result * factor % modulus;
+        }
+        factor = factor * factor % modulus;
+        exponent >>= 1;
+    }
+    return static_cast<unsigned>(result);
+} // end of the method power
+
+// -------------------------------rootTable------------------------------------
+// Description: The method rootTable returns the powers of the roots of unity
+// for transforms up to the given length. The powers of the primitive (2h)-th
+// root are stored at indices h to 2h - 1. Each thread keeps its own table,
+// which only grows.
+//
+// Parameter: length, which is the length of the transform.
+//
+// Parameter: invert, which selects the inverse roots.
+//
+// Return: A reference to the table.
+template <unsigned MODULUS>
+const std::vector<unsigned>& ModPoly::rootTable(size_t length, bool invert)
+{
+    static thread_local std::vector<unsigned> tables[2];
+    std::vector<unsigned>& table = tables[invert ? 1 : 0];
+    if (table.size() < length)
+    {
+        const unsigned root = 3;
+        size_t start = table.empty() ? 1 : table.size();
+        table.resize(length, 0);
+        for (size_t half = start; half < length; half <<= 1)
+        {
+            unsigned step = power(root, (MODULUS - 1) / (2 * half), MODULUS);
+            if (invert)
+            {
+                step = power(step, MODULUS - 2, MODULUS);
+            }
+            unsigned long long current = 1;
+            for (size_t j = 0; j < half; j++)
+            {
+                table[half + j] = static_cast<unsigned>(current);
+                current = current * step % MODULUS;
+            }
+        }
+    }
+    return table;
+} // end of the method rootTable
+
+// --------------------------------transform-----------------------------------
+// Description: The method transform performs the number-theoretic transform
+// of the given vector in place. The forward transform leaves the values in
+// bit-reversed order, and the inverse transform expects them in that order,
+// so a multiplication never has to reorder the values.
+//
+// Pre: The size of the vector must be a power of two that is not greater
+// than MAX_TRANSFORM. MODULUS must be PRIME_A or PRIME_B.
+//
+// Post: The vector holds its transform, or its inverse transform if invert
+// is true.
+//
+// Parameter: values, which is the vector to transform.
+//
+// Parameter: invert, which selects the inverse transform.
+template <unsigned MODULUS>
+void ModPoly::transform(std::vector<unsigned>& values, bool invert)
+{
+    size_t n = values.size();
+    const std::vector<unsigned>& roots = rootTable<MODULUS>(n, invert);
+    unsigned* data = values.data();
+
+    if (!invert)
+    {
+        // Decimation in frequency: butterflies first, then the twiddle.
+        for (size_t half = n / 2; half >= 1; half >>= 1)
+        {
+            const unsigned* twiddle = &roots[half];
+            for (size_t i = 0; i < n; i += 2 * half)
+            {
+                unsigned* low = data + i;
+                unsigned* high = low + half;
+                for (size_t j = 0; j < half; j++)
+                {
+                    unsigned u = low[j];
+                    unsigned v = high[j];
+                    low[j] = u + v >= MODULUS ? u + v - MODULUS : u + v;
+                    high[j] = static_cast<unsigned>(
+                        static_cast<unsigned long long>(u + MODULUS - v) * twiddle[j] % MODULUS);
+                }
+            }
+        }
+        return;
+    }
+
+    // Decimation in time: the twiddle first, then butterflies.
+    for (size_t half = 1; half < n; half <<= 1)
+    {
+        const unsigned* twiddle = &roots[half];
+        for (size_t i = 0; i < n; i += 2 * half)
+        {
+            unsigned* low = data + i;
+            unsigned* high = low + half;
+            for (size_t j = 0; j < half; j++)
+            {
+                unsigned u = low[j];
+                unsigned v = static_cast<unsigned>(
+                    static_cast<unsigned long long>(high[j]) * twiddle[j] % MODULUS);
+                low[j] = u + v >= MODULUS ? u + v - MODULUS : u + v;
+                high[j] = u >= v ? u - v : u + MODULUS - v;
+            }
+        }
+    }
+
+    unsigned long long scale = power(static_cast<unsigned>(n % MODULUS), MODULUS - 2, MODULUS);
+    for (size_t i = 0; i < n; i++)
+    {
+        values[i] = static_cast<unsigned>(values[i] * scale % MODULUS);
+    }
+} // end of the method transform
+
+// ------------------------------multiplyFixed---------------------------------
+// Description: The method multiplyFixed multiplies two coefficient vectors
+// modulo MODULUS, choosing between the schoolbook method and the transform.
+//
+// Pre: MODULUS must be PRIME_A or PRIME_B.
+//
+// Return: The coefficient vector of the product.
+template <unsigned MODULUS>
+std::vector<unsigned> ModPoly::multiplyFixed(const std::vector<unsigned>& a,
+                                             const std::vector<unsigned>& b)
+{
+    if (a.empty() || b.empty())
+    {
+        return std::vector<unsigned>();
+    }
+
+    size_t resultSize = a.size() + b.size() - 1;
+    std::vector<unsigned> result;
+
+    if (std::min(a.size(), b.size()) < static_cast<size_t>(SCHOOLBOOK_LIMIT))
+    {
+        std::vector<unsigned long long> sum(resultSize, 0);
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            unsigned long long factor = a[i];
+            for (size_t j = 0; j < b.size(); j++)
+            {
+                sum[i + j] = (sum[i + j] + factor * b[j]) % MODULUS;
+            }
+        }
+        result.assign(sum.begin(), sum.end());
+        return result;
+    }
+
+    if (resultSize > static_cast<size_t>(MAX_TRANSFORM))
+    {
+        // Split the longer operand in halves when the product is too long for
+        // a single transform.
+        const std::vector<unsigned>& longer = a.size() >= b.size() ? a : b;
+        const std::vector<unsigned>& shorter = a.size() >= b.size() ? b : a;
+        size_t half = longer.size() / 2;
+        std::vector<unsigned> low(longer.begin(), longer.begin() + half);
+        std::vector<unsigned> high(longer.begin() + half, longer.end());
+        std::vector<unsigned> lowProduct = multiplyFixed<MODULUS>(low, shorter);
+        std::vector<unsigned> highProduct = multiplyFixed<MODULUS>(high, shorter);
+
+        result.assign(resultSize, 0);
+        for (size_t i = 0; i < lowProduct.size(); i++)
+        {
+            result[i] = lowProduct[i];
+        }
+        for (size_t i = 0; i < highProduct.size(); i++)
+        {
+            unsigned sum = result[i + half] + highProduct[i];
+            result[i + half] = sum >= MODULUS ? sum - MODULUS : sum;
+        }
+        return result;
+    }
+
+    size_t length = 1;
+    while (length < resultSize)
+    {
+        length <<= 1;
+    }
+    std::vector<unsigned> left(a);
+    left.resize(length, 0);
+    transform<MODULUS>(left, false);
+    if (&a == &b)
+    {
+        // Squaring needs only one forward transform.
+        for (size_t i = 0; i < length; i++)
+        {
+            left[i] = static_cast<unsigned>(static_cast<unsigned long long>(left[i]) * left[i] % MODULUS);
+        }
+    }
+    else
+    {
+        std::vector<unsigned> right(b);
+        right.resize(length, 0);
+        transform<MODULUS>(right, false);
+        for (size_t i = 0; i < length; i++)
+        {
+            left[i] = static_cast<unsigned>(static_cast<unsigned long long>(left[i]) * right[i] % MODULUS);
+        }
+    }
+    transform<MODULUS>(left, true);
+    left.resize(resultSize);
+    return left;
+} // end of the method multiplyFixed
+
+// ----------------------------multiplyVectors---------------------------------
+// Description: The method multiplyVectors multiplies two coefficient vectors
+// by calling multiplyFixed with the given prime.
+//
+// Return: The coefficient vector of the product.
+std::vector<unsigned> ModPoly::multiplyVectors(const std::vector<unsigned>& a,
+    const std::vector<unsigned>& b, unsigned modulus)
+{
+    if (modulus == PRIME_A)
+    {
+        return multiplyFixed<PRIME_A>(a, b);
+    }
+    return multiplyFixed<PRIME_B>(a, b);
+} // end of the method multiplyVectors
+
+// ------------------------------buildTree-------------------------------------
+// Description: The method buildTree builds the subproduct tree over the
+// points in [low, high). Node k has children 2k and 2k + 1, and it holds the
+// product of (x - x_i) over its points.
+//
+// Parameter: tree, which holds the products.
+//
+// Parameter: points, which are the x residues.
+//
+// Parameter: node, which is the index of the node to build.
+//
+// Parameter: low, which is the first point of the node.
+//
+// Parameter: high, which is one past the last point of the node.
+void ModPoly::buildTree(std::vector<ModPoly>& tree, const std::vector<unsigned>& points,
+                        int node, int low, int high)
+{
+    ModPoly& product = tree[node];
+    if (high - low == 1)
+    {
+        unsigned modulus = product.mod;
+        product.coeff.resize(2);
+        product.coeff[0] = points[low] == 0 ? 0 : modulus - points[low];
+        product.coeff[1] = 1;
+        return;
+    }
+
+    int middle = (low + high) / 2;
+    buildTree(tree, points, 2 * node, low, middle);
+    buildTree(tree, points, 2 * node + 1, middle, high);
+    product = tree[2 * node] * tree[2 * node + 1];
+} // end of the method buildTree
+
+// ------------------------------composeRange----------------------------------
+// Description: The method composeRange composes the 2^level coefficients of
+// this polynomial that start at the given index with the inner polynomial.
+//
+// Parameter: powers, where powers[k] is the inner polynomial raised to the
+// power 2^k.
+//
+// Parameter: low, which is the index of the first coefficient.
+//
+// Parameter: level, which sets the number of coefficients to 2^level.
+//
+// Return: The sum of c_(low+i) * inner^i over the coefficients.
+ModPoly ModPoly::composeRange(const std::vector<ModPoly>& powers, size_t low, int level) const
+{
+    ModPoly result(mod);
+    if (low >= coeff.size())
+    {
+        return result;
+    }
+    if (level == 0)
+    {
+        if (coeff[low] != 0)
+        {
+            result.coeff.push_back(coeff[low]);
+        }
+        return result;
+    }
+
+    size_t half = static_cast<size_t>(1) << (level - 1);
+    ModPoly lower = composeRange(powers, low, level - 1);
+    ModPoly upper = composeRange(powers, low + half, level - 1);
+    if (upper.coeff.empty())
+    {
+        return lower;
+    }
+    return lower + upper * powers[level - 1];
+} // end of the method composeRange
+
+// ------------------------------middleProduct---------------------------------
+// Description: The method middleProduct computes the transposed product
+// c_j = sum over l of b_l * a_(j+l) for j < length, where the missing
+// entries of a are zero.
+//
+// Return: The vector c, which has the given length.
+std::vector<unsigned> ModPoly::middleProduct(const std::vector<unsigned>& a,
+    const std::vector<unsigned>& b, int length, unsigned modulus)
+{
+    std::vector<unsigned> result(length, 0);
+    size_t needed = std::min(a.size(), static_cast<size_t>(length) + b.size() - 1);
+    if (needed == 0 || b.empty())
+    {
+        return result;
+    }
+
+    if (std::min(static_cast<size_t>(length), b.size()) < static_cast<size_t>(SCHOOLBOOK_LIMIT))
+    {
+        for (int j = 0; j < length; j++)
+        {
+            unsigned long long sum = 0;
+            for (size_t l = 0; l < b.size() && j + l < needed; l++)
+            {
+                sum = (sum + static_cast<unsigned long long>(b[l]) * a[j + l]) % modulus;
+            }
+            result[j] = static_cast<unsigned>(sum);
+        }
+        return result;
+    }
+
+    // Entry j + |b| - 1 of a times b reversed is c_j.
+    std::vector<unsigned> front(a.begin(), a.begin() + needed);
+    std::vector<unsigned> reversed(b.rbegin(), b.rend());
+    std::vector<unsigned> product = multiplyVectors(front, reversed, modulus);
+    for (int j = 0; j < length; j++)
+    {
+        size_t index = j + b.size() - 1;
+        result[j] = index < product.size() ? product[index] : 0;
+    }
+    return result;
+} // end of the method middleProduct
+
+// ------------------------------evaluateRoot----------------------------------
+// Description: The method evaluateRoot evaluates the given polynomial at all
+// the points of a built subproduct tree. Instead of reducing remainders down
+// the tree, it works with the transpose of the evaluation map, so it needs
+// a single power series inverse at the root and two middle products at
+// every other node.
+//
+// Parameter: poly, which is the polynomial to evaluate.
+//
+// Parameter: values, which receives the values at the points.
+void ModPoly::evaluateRoot(const ModPoly& poly, const std::vector<ModPoly>& tree,
+                           const std::vector<unsigned>& points, std::vector<unsigned>& values)
+{
+    int n = static_cast<int>(points.size());
+    const ModPoly& root = tree[1];
+    unsigned modulus = root.mod;
+
+    // Only the remainder modulo the root product matters, and the remainder
+    // has fewer terms than there are points.
+    ModPoly reduced = poly.getDegree() >= n ? poly % root : poly;
+
+    // Entry j at the root is <f, t^j / R(t)>, which is the middle product of f
+    // and the series inverse of R.
+    ModPoly reversedRoot(modulus, std::vector<unsigned>(root.coeff.rbegin(), root.coeff.rend()));
+    ModPoly inverse = reversedRoot.inverse(n);
+    std::vector<unsigned> transposed = middleProduct(reduced.coeff, inverse.coeff, n, modulus);
+    evaluateTree(transposed, tree, points, values, 1, 0, n);
+} // end of the method evaluateRoot
+
+// ------------------------------evaluateTree----------------------------------
+// Description: The method evaluateTree passes the transposed values of a node
+// down to its children. For a node v whose product is P_v, entry j of the
+// transposed values is <f, t^j / R_v(t)>, where R_v is P_v reversed and
+// <f, s> is the sum of f_k * s_k. The value at a leaf point is its entry 0.
+//
+// Parameter: transposed, which are the transposed values of the node.
+//
+// Parameter: values, which receives the values at the points in [low, high).
+void ModPoly::evaluateTree(const std::vector<unsigned>& transposed,
+                           const std::vector<ModPoly>& tree,
+                           const std::vector<unsigned>& points, std::vector<unsigned>& values,
+                           int node, int low, int high)
+{
+    const std::vector<unsigned>& product = tree[node].coeff;
+    unsigned modulus = tree[node].mod;
+    int size = high - low;
+
+    if (size <= LEAF_LIMIT)
+    {
+        // f(x_i) = sum of c_j * entry j, where c is R_v / (1 - x_i t). The
+        // coefficient of t^j in R_v is the coefficient of x^(size - j) in P_v.
+        for (int i = low; i < high; i++)
+        {
+            unsigned long long c = 1;
+            unsigned long long sum = transposed[0];
+            for (int j = 1; j < size; j++)
+            {
+                c = (product[size - j] + c * points[i]) % modulus;
+                sum = (sum + c * transposed[j]) % modulus;
+            }
+            values[i] = static_cast<unsigned>(sum);
+        }
+        return;
+    }
+
+    // Entry j of a child is <f, t^j * R_sibling / R_v>, which is the middle
+    // product of the node's entries and the sibling's R.
+    int middle = (low + high) / 2;
+    const std::vector<unsigned>& leftProduct = tree[2 * node].coeff;
+    const std::vector<unsigned>& rightProduct = tree[2 * node + 1].coeff;
+    std::vector<unsigned> leftReversed(rightProduct.rbegin(), rightProduct.rend());
+    std::vector<unsigned> rightReversed(leftProduct.rbegin(), leftProduct.rend());
+
+    evaluateTree(middleProduct(transposed, leftReversed, middle - low, modulus),
+                 tree, points, values, 2 * node, low, middle);
+    evaluateTree(middleProduct(transposed, rightReversed, high - middle, modulus),
+                 tree, points, values, 2 * node + 1, middle, high);
+} // end of the method evaluateTree
+
+// -----------------------------combineTree------------------------------------
+// Description: The method combineTree returns the sum of weight_i times the
+// product of (x - x_j) over j != i, for the points i in [low, high).
+//
+// Parameter: weights, which are y_i divided by the derivative of the root
+// product at x_i.
+ModPoly ModPoly::combineTree(const std::vector<ModPoly>& tree,
+                             const std::vector<unsigned>& weights, unsigned modulus,
+                             int node, int low, int high)
+{
+    if (high - low == 1)
+    {
+        ModPoly constant(modulus);
+        if (weights[low] != 0)
+        {
+            constant.coeff.push_back(weights[low]);
+        }
+        return constant;
+    }
+
+    // Each half is missing the factors of the other half.
+    int middle = (low + high) / 2;
+    ModPoly left = combineTree(tree, weights, modulus, 2 * node, low, middle);
+    ModPoly right = combineTree(tree, weights, modulus, 2 * node + 1, middle, high);
+    return left * tree[2 * node + 1] + right * tree[2 * node];
+} // end of the method combineTree
@@ -0,0 +1,448 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// ------------------------------- modpoly.h ----------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the ModPoly class that represents a
+// polynomial whose coefficients are integers modulo a prime. The prime must
+// support the number-theoretic transform, so the ModPoly class can multiply
+// two polynomials in O(n log n) time. On top of the fast multiplication, the
+// ModPoly class supports division with remainder, multipoint evaluation, and
+// interpolation through a subproduct tree.
+//
+// Note: The Poly class uses the ModPoly class over two primes and combines the
+// two results with the Chinese remainder theorem. The combined coefficient is
+// exact as long as the true coefficient fits in an int.
+// ----------------------------------------------------------------------------
+
+
+class ModPoly
+{
+public:
+    // The two primes that the Poly class works over. Both primes are of the form
+    // c * 2^k + 1 and have 3 as a primitive root.
+    static const unsigned PRIME_A = 998244353;
+    static const unsigned PRIME_B = 469762049;
+
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates a zero polynomial
+    // modulo the given prime.
+    //
+    // Pre: The given modulus must be PRIME_A or PRIME_B.
+    //
+    // Post: A zero polynomial modulo the given prime exists.
+    //
+    // Parameter: modulus, which is the prime that the coefficients are reduced
+    // by.
+    explicit ModPoly(unsigned modulus);
+
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates a polynomial modulo the
+    // given prime whose coefficients are the given residues.
+    //
+    // Pre: The given modulus must be PRIME_A or PRIME_B. Every residue must be
+    // less than the modulus.
+    //
+    // Post: A polynomial whose coefficient of x^i is the i-th residue exists.
+    //
+    // Parameter: modulus, which is the prime that the coefficients are reduced
+    // by.
+    //
+    // Parameter: coefficients, which are the residues in increasing power order.
+    ModPoly(unsigned modulus, const std::vector<unsigned>& coefficients);
+
+    // -------------------------------getDegree------------------------------------
+    // Description: The method getDegree returns the degree of this polynomial.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Return: The degree of this polynomial; -1 if this polynomial is zero.
+    int getDegree() const;
+
+    // --------------------------------getCoeff------------------------------------
+    // Description: The method getCoeff returns the residue of the given power.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: power, which is the power whose coefficient should be returned.
+    //
+    // Return: The coefficient of the given power; zero if the power is negative
+    // or greater than the degree.
+    unsigned getCoeff(int power) const;
+
+    // ------------------------------operator + -----------------------------------
+    // Description: The method operator+ adds this polynomial and the polynomial
+    // on the right hand side.
+    //
+    // Pre: Both polynomials must have the same modulus.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the addition.
+    ModPoly operator+(const ModPoly& rhs) const;
+
+    // ------------------------------operator - -----------------------------------
+    // Description: The method operator- subtracts the polynomial on the right
+    // hand side from this polynomial.
+    //
+    // Pre: Both polynomials must have the same modulus.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the subtraction.
+    ModPoly operator-(const ModPoly& rhs) const;
+
+    // ------------------------------operator * -----------------------------------
+    // Description: The method operator* multiplies this polynomial by the
+    // polynomial on the right hand side. Short operands are multiplied by the
+    // schoolbook method; longer operands go through the number-theoretic
+    // transform.
+    //
+    // Pre: Both polynomials must have the same modulus.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the multiplication.
+    ModPoly operator*(const ModPoly& rhs) const;
+
+    // ------------------------------operator / -----------------------------------
+    // Description: The method operator/ divides this polynomial by the polynomial
+    // on the right hand side and returns the quotient.
+    //
+    // Pre: Both polynomials must have the same modulus. The divisor cannot be
+    // zero.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, the divisor.
+    //
+    // Return: The quotient of the division.
+    ModPoly operator/(const ModPoly& rhs) const;
+
+    // ------------------------------operator % -----------------------------------
+    // Description: The method operator% divides this polynomial by the polynomial
+    // on the right hand side and returns the remainder.
+    //
+    // Pre: Both polynomials must have the same modulus. The divisor cannot be
+    // zero.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, the divisor.
+    //
+    // Return: The remainder of the division, whose degree is less than the degree
+    // of the divisor.
+    ModPoly operator%(const ModPoly& rhs) const;
+
+    // -------------------------------derivative-----------------------------------
+    // Description: The method derivative returns the formal derivative of this
+    // polynomial.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Return: The derivative of this polynomial.
+    ModPoly derivative() const;
+
+    // --------------------------------inverse-------------------------------------
+    // Description: The method inverse computes the power series inverse of this
+    // polynomial modulo x^terms with Newton iteration.
+    //
+    // Pre: The constant term of this polynomial cannot be zero.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: terms, which is the number of terms of the inverse to compute.
+    //
+    // Return: A polynomial g of degree less than terms such that this polynomial
+    // times g is 1 modulo x^terms.
+    ModPoly inverse(int terms) const;
+
+    // -------------------------------taylorShift----------------------------------
+    // Description: The method taylorShift returns this polynomial with x
+    // replaced by x + shift. It scales the coefficients by factorials and does
+    // a single convolution, which takes O(n log n) time.
+    //
+    // Pre: The degree of this polynomial must be less than the modulus.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: shift, which is the residue to shift by.
+    //
+    // Return: The shifted polynomial.
+    ModPoly taylorShift(unsigned shift) const;
+
+    // ---------------------------------compose------------------------------------
+    // Description: The method compose returns this polynomial evaluated at the
+    // given polynomial. It splits this polynomial into a low half and a high
+    // half, so p(q) = low(q) + q^half * high(q), and reuses the powers q^(2^k)
+    // at every level. This takes O(M(N) log n) time, where N is the degree of
+    // the result and M is the cost of a multiplication.
+    //
+    // Pre: Both polynomials must have the same modulus.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: inner, which is the polynomial to substitute for x.
+    //
+    // Return: The composition of this polynomial and the given polynomial.
+    ModPoly compose(const ModPoly& inner) const;
+
+    // --------------------------------evaluate------------------------------------
+    // Description: The method evaluate computes the value of this polynomial at
+    // the given point by Horner's rule.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: x, which is the residue to evaluate at.
+    //
+    // Return: The value of this polynomial at x.
+    unsigned evaluate(unsigned x) const;
+
+    // --------------------------------evaluate------------------------------------
+    // Description: The method evaluate computes the values of this polynomial at
+    // all the given points by descending a subproduct tree, which takes
+    // O(n log^2 n) time.
+    //
+    // Pre: Every point must be less than the modulus.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: points, which are the residues to evaluate at.
+    //
+    // Return: The values of this polynomial at the points, in the same order.
+    std::vector<unsigned> evaluate(const std::vector<unsigned>& points) const;
+
+    // ------------------------------interpolate-----------------------------------
+    // Description: The method interpolate builds the polynomial of degree less
+    // than n that passes through the given n points, using the subproduct tree.
+    // This takes O(n log^2 n) time.
+    //
+    // Pre: The two vectors must have the same size, and every residue must be
+    // less than the modulus. The x residues must be distinct.
+    //
+    // Post: The given result holds the interpolating polynomial. If two x
+    // residues are the same, the result is zero and this method returns false.
+    //
+    // Parameter: x, which are the x residues of the points.
+    //
+    // Parameter: y, which are the y residues of the points.
+    //
+    // Parameter: result, which holds the interpolating polynomial.
+    //
+    // Return: True if the x residues are distinct; false otherwise.
+    static bool interpolate(const std::vector<unsigned>& x,
+                            const std::vector<unsigned>& y, ModPoly& result);
+
+    // ---------------------------interpolateNewton--------------------------------
+    // Description: The method interpolateNewton builds the polynomial of degree
+    // less than n that passes through the given n points, using Newton's divided
+    // differences. This takes O(n^2) time with a small constant, so it is faster
+    // than the subproduct tree for a small number of points.
+    //
+    // Pre: The two vectors must have the same size, and every residue must be
+    // less than the modulus. The x residues must be distinct.
+    //
+    // Post: The given result holds the interpolating polynomial. If two x
+    // residues are the same, the result is zero and this method returns false.
+    //
+    // Parameter: x, which are the x residues of the points.
+    //
+    // Parameter: y, which are the y residues of the points.
+    //
+    // Parameter: result, which holds the interpolating polynomial.
+    //
+    // Return: True if the x residues are distinct; false otherwise.
+    static bool interpolateNewton(const std::vector<unsigned>& x,
+                                  const std::vector<unsigned>& y, ModPoly& result);
+
+    // ---------------------------------reduce-------------------------------------
+    // Description: The method reduce maps an integer to its residue.
+    //
+    // Parameter: value, which is the integer to reduce.
+    //
+    // Parameter: modulus, which is the prime to reduce by.
+    //
+    // Return: The residue of the given value, between 0 and modulus - 1.
+    static unsigned reduce(long long value, unsigned modulus);
+
+    // ---------------------------------combine------------------------------------
+    // Description: The method combine uses the Chinese remainder theorem to
+    // recover an integer from its residues modulo PRIME_A and PRIME_B.
+    //
+    // Pre: The integer to recover must fit in an int.
+    //
+    // Parameter: residueA, which is the residue modulo PRIME_A.
+    //
+    // Parameter: residueB, which is the residue modulo PRIME_B.
+    //
+    // Return: The integer whose residues are the given residues.
+    static int combine(unsigned residueA, unsigned residueB);
+
+private:
+    // The coefficient of x^i is stored at index i. The vector never ends with a
+    // zero, so a zero polynomial is an empty vector.
+    std::vector<unsigned> coeff;
+    unsigned mod;
+
+    // Operands shorter than this are multiplied by the schoolbook method.
+    static const int SCHOOLBOOK_LIMIT = 48;
+
+    // The longest transform that both primes support.
+    static const int MAX_TRANSFORM = 1 << 23;
+
+    // A node of the subproduct tree with at most this many points evaluates its
+    // points directly instead of descending further.
+    static const int LEAF_LIMIT = 32;
+
+    // ---------------------------------trim---------------------------------------
+    // Description: The method trim removes the zero coefficients at the end of
+    // the coefficient vector.
+    //
+    // Post: The coefficient vector does not end with a zero.
+    void trim();
+
+    // ---------------------------------power--------------------------------------
+    // Description: The method power raises the given base to the given exponent.
+    //
+    // Return: base^exponent modulo the given modulus.
+    static unsigned power(unsigned base, unsigned long long exponent, unsigned modulus);
+
+    // -------------------------------rootTable------------------------------------
+    // Description: The method rootTable returns the powers of the roots of unity
+    // for transforms up to the given length. The powers of the primitive (2h)-th
+    // root are stored at indices h to 2h - 1. Each thread keeps its own table,
+    // which only grows.
+    //
+    // Parameter: length, which is the length of the transform.
+    //
+    // Parameter: invert, which selects the inverse roots.
+    //
+    // Return: A reference to the table.
+    template <unsigned MODULUS>
+    static const std::vector<unsigned>& rootTable(size_t length, bool invert);
+
+    // --------------------------------transform-----------------------------------
+    // Description: The method transform performs the number-theoretic transform
+    // of the given vector in place. The forward transform leaves the values in
+    // bit-reversed order, and the inverse transform expects them in that order,
+    // so a multiplication never has to reorder the values.
+    //
+    // Pre: The size of the vector must be a power of two that is not greater
+    // than MAX_TRANSFORM. MODULUS must be PRIME_A or PRIME_B.
+    //
+    // Post: The vector holds its transform, or its inverse transform if invert
+    // is true.
+    //
+    // Parameter: values, which is the vector to transform.
+    //
+    // Parameter: invert, which selects the inverse transform.
+    template <unsigned MODULUS>
+    static void transform(std::vector<unsigned>& values, bool invert);
+
+    // ------------------------------multiplyFixed---------------------------------
+    // Description: The method multiplyFixed multiplies two coefficient vectors
+    // modulo MODULUS, choosing between the schoolbook method and the transform.
+    //
+    // Pre: MODULUS must be PRIME_A or PRIME_B.
+    //
+    // Return: The coefficient vector of the product.
+    template <unsigned MODULUS>
+    static std::vector<unsigned> multiplyFixed(const std::vector<unsigned>& a,
+                                               const std::vector<unsigned>& b);
+
+    // ----------------------------multiplyVectors---------------------------------
+    // Description: The method multiplyVectors multiplies two coefficient vectors
+    // by calling multiplyFixed with the given prime.
+    //
+    // Return: The coefficient vector of the product.
+    static std::vector<unsigned> multiplyVectors(const std::vector<unsigned>& a,
+        const std::vector<unsigned>& b, unsigned modulus);
+
+    // ------------------------------buildTree-------------------------------------
+    // Description: The method buildTree builds the subproduct tree over the
+    // points in [low, high). Node k has children 2k and 2k + 1, and it holds the
+    // product of (x - x_i) over its points.
+    //
+    // Parameter: tree, which holds the products.
+    //
+    // Parameter: points, which are the x residues.
+    //
+    // Parameter: node, which is the index of the node to build.
+    //
+    // Parameter: low, which is the first point of the node.
+    //
+    // Parameter: high, which is one past the last point of the node.
+    static void buildTree(std::vector<ModPoly>& tree, const std::vector<unsigned>& points,
+                          int node, int low, int high);
+
+    // ------------------------------composeRange----------------------------------
+    // Description: The method composeRange composes the 2^level coefficients of
+    // this polynomial that start at the given index with the inner polynomial.
+    //
+    // Parameter: powers, where powers[k] is the inner polynomial raised to the
+    // power 2^k.
+    //
+    // Parameter: low, which is the index of the first coefficient.
+    //
+    // Parameter: level, which sets the number of coefficients to 2^level.
+    //
+    // Return: The sum of c_(low+i) * inner^i over the coefficients.
+    ModPoly composeRange(const std::vector<ModPoly>& powers, size_t low, int level) const;
+
+    // ------------------------------middleProduct---------------------------------
+    // Description: The method middleProduct computes the transposed product
+    // c_j = sum over l of b_l * a_(j+l) for j < length, where the missing
+    // entries of a are zero.
+    //
+    // Return: The vector c, which has the given length.
+    static std::vector<unsigned> middleProduct(const std::vector<unsigned>& a,
+        const std::vector<unsigned>& b, int length, unsigned modulus);
+
+    // ------------------------------evaluateRoot----------------------------------
+    // Description: The method evaluateRoot evaluates the given polynomial at all
+    // the points of a built subproduct tree. Instead of reducing remainders down
+    // the tree, it works with the transpose of the evaluation map, so it needs
+    // a single power series inverse at the root and two middle products at
+    // every other node.
+    //
+    // Parameter: poly, which is the polynomial to evaluate.
+    //
+    // Parameter: values, which receives the values at the points.
+    static void evaluateRoot(const ModPoly& poly, const std::vector<ModPoly>& tree,
+                             const std::vector<unsigned>& points, std::vector<unsigned>& values);
+
+    // ------------------------------evaluateTree----------------------------------
+    // Description: The method evaluateTree passes the transposed values of a node
+    // down to its children. For a node v whose product is P_v, entry j of the
+    // transposed values is <f, t^j / R_v(t)>, where R_v is P_v reversed and
+    // <f, s> is the sum of f_k * s_k. The value at a leaf point is its entry 0.
+    //
+    // Parameter: transposed, which are the transposed values of the node.
+    //
+    // Parameter: values, which receives the values at the points in [low, high).
+    static void evaluateTree(const std::vector<unsigned>& transposed,
+                             const std::vector<ModPoly>& tree,
+                             const std::vector<unsigned>& points, std::vector<unsigned>& values,
+                             int node, int low, int high);
+
+    // -----------------------------combineTree------------------------------------
+    // Description: The method combineTree returns the sum of weight_i times the
+    // product of (x - x_j) over j != i, for the points i in [low, high).
+    //
+    // Parameter: weights, which are y_i divided by the derivative of the root
+    // product at x_i.
+    static ModPoly combineTree(const std::vector<ModPoly>& tree,
+                               const std::vector<unsigned>& weights, unsigned modulus,
+                               int node, int low, int high);
+};
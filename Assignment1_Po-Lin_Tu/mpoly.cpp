@@ -0,0 +1,507 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "mpoly.h"
+
+// ------------------------------- mpoly.cpp ----------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the MPoly class that
+// represents a sparse polynomial in up to eight variables with the exponents
+// of every monomial packed into one 64-bit word.
+//
+// Note: Coefficients are added and multiplied as unsigned integers and cast
+// back, so they wrap the same way as the coefficients of the Poly class.
+// ----------------------------------------------------------------------------
+
+// One candidate product in the heap of operator*: the product of the i-th
+// term of the smaller polynomial and the j-th term of the larger one.
+struct HeapEntry
+{
+    unsigned long long monomial;
+    size_t i;
+    size_t j;
+};
+
+// Orders the heap so that the smallest monomial is on top.
+static bool laterEntry(const HeapEntry& lhs, const HeapEntry& rhs)
+{
+    return lhs.monomial > rhs.monomial;
+}
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates a zero polynomial in
+// the given number of variables.
+//
+// Pre: The number of variables must be between 1 and MAX_VARIABLES.
+//
+// Post: A zero polynomial exists. A number of variables out of range is
+// moved to the nearest end of the range.
+//
+// Parameter: variables, which is the number of variables.
+MPoly::MPoly(int variables) : variables(variables), fieldBits(0), guardBits(0)
+{
+    if (this->variables < 1)
+    {
+        this->variables = 1;
+    }
+    if (this->variables > MAX_VARIABLES)
+    {
+        this->variables = MAX_VARIABLES;
+    }
+
+    // A field is at most 32 bits wide, so the guard bit of a single variable
+    // is bit 31 and every exponent below it fits in an int.
+    fieldBits = std::min(64 / this->variables, 32);
+    for (int variable = 0; variable < this->variables; variable++)
+    {
+        guardBits |= 1ULL << ((this->variables - 1 - variable) * fieldBits + fieldBits - 1);
+    }
+} // end of this parametrized constructor
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates a polynomial in the
+// given number of variables from a polynomial in one of them.
+//
+// Pre: The number of variables must be between 1 and MAX_VARIABLES, and the
+// variable must be below the number of variables.
+//
+// Post: A polynomial whose terms are the terms of the given polynomial in
+// the given variable exists.
+//
+// Parameter: univariate, which is the polynomial to convert.
+//
+// Parameter: variables, which is the number of variables.
+//
+// Parameter: variable, which is the variable that x becomes.
+MPoly::MPoly(const Poly& univariate, int variables, int variable) : MPoly(variables)
+{
+    if (variable < 0 || variable >= this->variables)
+    {
+        return;
+    }
+
+    // The powers increase, so the packed monomials come out sorted.
+    int shift = (this->variables - 1 - variable) * fieldBits;
+    int highest = std::min(univariate.max - 1, getMaxExponent());
+    for (int power = 0; power <= highest; power++)
+    {
+        if (univariate.poly[power] != 0)
+        {
+            monomials.push_back(static_cast<unsigned long long>(power) << shift);
+            coeffs.push_back(univariate.poly[power]);
+        }
+    }
+} // end of this parametrized constructor
+
+// -----------------------------getVariables-----------------------------------
+// Description: The method getVariables returns the number of variables.
+//
+// Return: The number of variables.
+int MPoly::getVariables() const
+{
+    return variables;
+} // end of the method getVariables
+
+// -----------------------------getTermCount-----------------------------------
+// Description: The method getTermCount returns the number of nonzero terms.
+//
+// Return: The number of nonzero terms.
+size_t MPoly::getTermCount() const
+{
+    return monomials.size();
+} // end of the method getTermCount
+
+// ---------------------------getMaxExponent-----------------------------------
+// Description: The method getMaxExponent returns the largest exponent that
+// one variable can have.
+//
+// Return: The largest exponent.
+int MPoly::getMaxExponent() const
+{
+    return static_cast<int>((1ULL << (fieldBits - 1)) - 1);
+} // end of the method getMaxExponent
+
+// --------------------------------getCoeff------------------------------------
+// Description: The method getCoeff returns the coefficient of the given
+// monomial by binary search.
+//
+// Parameter: exponents, which holds one exponent for each variable.
+//
+// Return: The coefficient; zero if the monomial is not a term or an
+// exponent is out of range.
+int MPoly::getCoeff(const std::vector<int>& exponents) const
+{
+    unsigned long long monomial;
+    if (!pack(exponents, monomial))
+    {
+        return 0;
+    }
+
+    std::vector<unsigned long long>::const_iterator found =
+        std::lower_bound(monomials.begin(), monomials.end(), monomial);
+    if (found == monomials.end() || *found != monomial)
+    {
+        return 0;
+    }
+    return coeffs[found - monomials.begin()];
+} // end of the method getCoeff
+
+// --------------------------------setCoeff------------------------------------
+// Description: The method setCoeff sets the coefficient of the given
+// monomial. A monomial above every current term is appended in O(1), so
+// setting terms in increasing order builds a polynomial in linear time;
+// any other monomial is inserted in O(n).
+//
+// Pre: There must be one exponent for each variable, and every exponent
+// must be between zero and getMaxExponent().
+//
+// Post: The coefficient of the monomial becomes the given integer. If an
+// exponent is out of range, this method does nothing.
+//
+// Parameter: coefficient, which is the new coefficient.
+//
+// Parameter: exponents, which holds one exponent for each variable.
+void MPoly::setCoeff(int coefficient, const std::vector<int>& exponents)
+{
+    unsigned long long monomial;
+    if (!pack(exponents, monomial))
+    {
+        return;
+    }
+
+    if (monomials.empty() || monomials.back() < monomial)
+    {
+        if (coefficient != 0)
+        {
+            monomials.push_back(monomial);
+            coeffs.push_back(coefficient);
+        }
+        return;
+    }
+
+    size_t index = std::lower_bound(monomials.begin(), monomials.end(), monomial) - monomials.begin();
+    if (monomials[index] == monomial)
+    {
+        if (coefficient != 0)
+        {
+            coeffs[index] = coefficient;
+        }
+        else
+        {
+            monomials.erase(monomials.begin() + index);
+            coeffs.erase(coeffs.begin() + index);
+        }
+    }
+    else if (coefficient != 0)
+    {
+        monomials.insert(monomials.begin() + index, monomial);
+        coeffs.insert(coeffs.begin() + index, coefficient);
+    }
+} // end of the method setCoeff
+
+// ------------------------------operator + -----------------------------------
+// Description: The method operator+ adds this polynomial and the polynomial
+// on the right hand side by merging their sorted terms in O(n + m) time.
+//
+// Pre: Both polynomials must have the same number of variables.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the addition.
+MPoly MPoly::operator+(const MPoly& rhs) const
+{
+    return merge(rhs, 1);
+} // end of the method operator+
+
+// ------------------------------operator - -----------------------------------
+// Description: The method operator- subtracts the polynomial on the right
+// hand side from this polynomial by merging their sorted terms in O(n + m)
+// time.
+//
+// Pre: Both polynomials must have the same number of variables.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the subtraction.
+MPoly MPoly::operator-(const MPoly& rhs) const
+{
+    return merge(rhs, -1);
+} // end of the method operator-
+
+// ------------------------------operator * -----------------------------------
+// Description: The method operator* multiplies this polynomial by the
+// polynomial on the right hand side. A heap holds the next product of
+// every term of the smaller polynomial, so the products come out in
+// increasing order and like terms are combined as they are produced. This
+// takes O(nm log n) time and O(n) memory beyond the result, where n is the
+// number of terms in the smaller polynomial.
+//
+// Pre: Both polynomials must have the same number of variables. No
+// exponent of the product may exceed getMaxExponent().
+//
+// Post: Both polynomials do not change. If an exponent of the product
+// overflows its field, this method returns a zero polynomial.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Return: A new polynomial that is the result of the multiplication.
+MPoly MPoly::operator*(const MPoly& rhs) const
+{
+    MPoly result(variables);
+    const MPoly& small = monomials.size() <= rhs.monomials.size() ? *this : rhs;
+    const MPoly& large = monomials.size() <= rhs.monomials.size() ? rhs : *this;
+    if (small.monomials.empty())
+    {
+        return result;
+    }
+
+    // Row i of the product is small[i] times every term of large, and it
+    // increases along the row. The heap starts with row 0 and only adds row
+    // i + 1 once small[i] * large[0] has been taken, because nothing in row
+    // i + 1 can come before it. So the heap never holds more than one entry
+    // per row.
+    std::vector<HeapEntry> heap;
+    heap.reserve(small.monomials.size());
+    heap.push_back({ small.monomials[0] + large.monomials[0], 0, 0 });
+
+    unsigned long long overflow = 0;
+    while (!heap.empty())
+    {
+        unsigned long long monomial = heap.front().monomial;
+        unsigned sum = 0;
+        while (!heap.empty() && heap.front().monomial == monomial)
+        {
+            std::pop_heap(heap.begin(), heap.end(), laterEntry);
+            HeapEntry entry = heap.back();
+            heap.pop_back();
+            sum += static_cast<unsigned>(small.coeffs[entry.i]) *
+                   static_cast<unsigned>(large.coeffs[entry.j]);
+
+            if (entry.j == 0 && entry.i + 1 < small.monomials.size())
+            {
+                heap.push_back({ small.monomials[entry.i + 1] + large.monomials[0], entry.i + 1, 0 });
+                std::push_heap(heap.begin(), heap.end(), laterEntry);
+            }
+            if (entry.j + 1 < large.monomials.size())
+            {
+                heap.push_back({ small.monomials[entry.i] + large.monomials[entry.j + 1],
+                                 entry.i, entry.j + 1 });
+                std::push_heap(heap.begin(), heap.end(), laterEntry);
+            }
+        }
+
+        overflow |= monomial;
+        if (sum != 0)
+        {
+            result.monomials.push_back(monomial);
+            result.coeffs.push_back(static_cast<int>(sum));
+        }
+    }
+
+    if ((overflow & guardBits) != 0)
+    {
+        return MPoly(variables);
+    }
+    return result;
+} // end of the method operator*
+
+// ------------------------------operator == ----------------------------------
+// Description: The method operator== reports whether this polynomial and
+// the polynomial on the right hand side have the same terms.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Return: True if the two polynomials are the same; false otherwise.
+bool MPoly::operator==(const MPoly& rhs) const
+{
+    return variables == rhs.variables && monomials == rhs.monomials && coeffs == rhs.coeffs;
+} // end of the method operator==
+
+// ------------------------------operator != ----------------------------------
+// Description: The method operator!= reports whether this polynomial and
+// the polynomial on the right hand side have different terms.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Return: True if the two polynomials are different; false otherwise.
+bool MPoly::operator!=(const MPoly& rhs) const
+{
+    return !operator==(rhs);
+} // end of the method operator!=
+
+// --------------------------------toPoly--------------------------------------
+// Description: The method toPoly converts this polynomial to a polynomial
+// in the given variable.
+//
+// Pre: No other variable may appear in a term.
+//
+// Post: This polynomial does not change.
+//
+// Parameter: variable, which is the variable that becomes x.
+//
+// Parameter: result, which receives the converted polynomial.
+//
+// Return: True if only the given variable appears, with no exponent above
+// getMaxExponent(); false otherwise, in which case the result does not
+// change.
+bool MPoly::toPoly(int variable, Poly& result) const
+{
+    if (variable < 0 || variable >= variables)
+    {
+        return false;
+    }
+
+    int shift = (variables - 1 - variable) * fieldBits;
+    unsigned long long field = ((1ULL << fieldBits) - 1) << shift;
+    for (size_t i = 0; i < monomials.size(); i++)
+    {
+        if ((monomials[i] & ~field) != 0 || unpack(monomials[i], variable) > getMaxExponent())
+        {
+            return false;
+        }
+    }
+
+    Poly converted(0, monomials.empty() ? 0 : unpack(monomials.back(), variable));
+    for (size_t i = 0; i < monomials.size(); i++)
+    {
+        converted.poly[unpack(monomials[i], variable)] = coeffs[i];
+    }
+    result = converted;
+    return true;
+} // end of the method toPoly
+
+// ------------------------------operator << ----------------------------------
+// Description: The method operator<< writes the terms of a polynomial from
+// the highest monomial to the lowest, naming the variables x0, x1, and so
+// on, in the same form as the Poly class.
+//
+// Parameter: lhs, which is the ostream object.
+//
+// Parameter: rhs, which is the polynomial to write.
+//
+// Return: A reference to the ostream object.
+std::ostream& operator<<(std::ostream& lhs, const MPoly& rhs)
+{
+    if (rhs.monomials.empty())
+    {
+        lhs << "0";
+        return lhs;
+    }
+
+    for (size_t i = rhs.monomials.size(); i-- > 0;)
+    {
+        lhs << (rhs.coeffs[i] > 0 ? " +" : " ") << rhs.coeffs[i];
+        for (int variable = 0; variable < rhs.variables; variable++)
+        {
+            int exponent = rhs.unpack(rhs.monomials[i], variable);
+            if (exponent == 1)
+            {
+                lhs << "x" << variable;
+            }
+            else if (exponent > 1)
+            {
+                lhs << "x" << variable << "^" << exponent;
+            }
+        }
+    }
+    return lhs;
+} // end of the method operator<<
+
+// ----------------------------------pack--------------------------------------
+// Description: The method pack packs the given exponents into one word.
+//
+// Parameter: exponents, which holds one exponent for each variable.
+//
+// Parameter: monomial, which receives the packed word.
+//
+// Return: True if every exponent fits in its field; false otherwise.
+bool MPoly::pack(const std::vector<int>& exponents, unsigned long long& monomial) const
+{
+    if (static_cast<int>(exponents.size()) != variables)
+    {
+        return false;
+    }
+
+    int largest = getMaxExponent();
+    monomial = 0;
+    for (int variable = 0; variable < variables; variable++)
+    {
+        if (exponents[variable] < 0 || exponents[variable] > largest)
+        {
+            return false;
+        }
+        monomial |= static_cast<unsigned long long>(exponents[variable])
+                    << ((variables - 1 - variable) * fieldBits);
+    }
+    return true;
+} // end of the method pack
+
+// ---------------------------------unpack-------------------------------------
+// Description: The method unpack returns the exponent of one variable in a
+// packed word.
+//
+// Parameter: monomial, which is the packed word.
+//
+// Parameter: variable, which is the index of the variable.
+//
+// Return: The exponent of the variable.
+int MPoly::unpack(unsigned long long monomial, int variable) const
+{
+    unsigned long long field = monomial >> ((variables - 1 - variable) * fieldBits);
+    return static_cast<int>(field & ((1ULL << fieldBits) - 1));
+} // end of the method unpack
+
+// ----------------------------------merge-------------------------------------
+// Description: The method merge adds or subtracts the terms of another
+// polynomial in one pass over both sorted term lists.
+//
+// Parameter: rhs, which is the polynomial on the right hand side.
+//
+// Parameter: sign, which is 1 to add and -1 to subtract.
+//
+// Return: The sum or the difference.
+MPoly MPoly::merge(const MPoly& rhs, int sign) const
+{
+    MPoly result(variables);
+    result.monomials.reserve(monomials.size() + rhs.monomials.size());
+    result.coeffs.reserve(monomials.size() + rhs.monomials.size());
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < monomials.size() || j < rhs.monomials.size())
+    {
+        unsigned long long monomial;
+        unsigned sum = 0;
+        if (j == rhs.monomials.size() ||
+            (i < monomials.size() && monomials[i] < rhs.monomials[j]))
+        {
+            monomial = monomials[i];
+            sum = static_cast<unsigned>(coeffs[i++]);
+        }
+        else if (i == monomials.size() || rhs.monomials[j] < monomials[i])
+        {
+            monomial = rhs.monomials[j];
+            sum = static_cast<unsigned>(sign) * static_cast<unsigned>(rhs.coeffs[j++]);
+        }
+        else
+        {
+            monomial = monomials[i];
+            sum = static_cast<unsigned>(coeffs[i++]) +
+                  static_cast<unsigned>(sign) * static_cast<unsigned>(rhs.coeffs[j++]);
+        }
+
+        if (sum != 0)
+        {
+            result.monomials.push_back(monomial);
+            result.coeffs.push_back(static_cast<int>(sum));
+        }
+    }
+    return result;
+} // end of the method merge
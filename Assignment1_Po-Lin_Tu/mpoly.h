@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "poly.h"
+
+// -------------------------------- mpoly.h -----------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the MPoly class that represents a
+// sparse polynomial in up to eight variables. The MPoly class stores only the
+// nonzero terms, sorted by monomial, and packs the exponents of a monomial
+// into one 64-bit word. Multiplying two monomials is then one addition of
+// words and comparing them is one comparison of words. The MPoly class
+// supports addition and subtraction by merging the sorted terms,
+// multiplication with a heap of candidate products, and conversion to and
+// from the Poly class.
+//
+// Note: The word is split into one field per variable, with the first
+// variable in the most significant field, so sorting the words sorts the
+// monomials in lexicographic order. The top bit of every field is a guard
+// bit that stays clear for a valid exponent, so an exponent that overflows
+// its field sets the guard bit instead of carrying into the next field. A
+// field is at most 32 bits wide, so a valid exponent always fits in an int.
+// ----------------------------------------------------------------------------
+
+class MPoly
+{
+private:
+    // The packed monomials in increasing order and their nonzero coefficients.
+    std::vector<unsigned long long> monomials;
+    std::vector<int> coeffs;
+
+    int variables;
+    int fieldBits;
+    unsigned long long guardBits;
+
+    // ----------------------------------pack--------------------------------------
+    // Description: The method pack packs the given exponents into one word.
+    //
+    // Parameter: exponents, which holds one exponent for each variable.
+    //
+    // Parameter: monomial, which receives the packed word.
+    //
+    // Return: True if every exponent fits in its field; false otherwise.
+    bool pack(const std::vector<int>& exponents, unsigned long long& monomial) const;
+
+    // ---------------------------------unpack-------------------------------------
+    // Description: The method unpack returns the exponent of one variable in a
+    // packed word.
+    //
+    // Parameter: monomial, which is the packed word.
+    //
+    // Parameter: variable, which is the index of the variable.
+    //
+    // Return: The exponent of the variable.
+    int unpack(unsigned long long monomial, int variable) const;
+
+    // ----------------------------------merge-------------------------------------
+    // Description: The method merge adds or subtracts the terms of another
+    // polynomial in one pass over both sorted term lists.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Parameter: sign, which is 1 to add and -1 to subtract.
+    //
+    // Return: The sum or the difference.
+    MPoly merge(const MPoly& rhs, int sign) const;
+
+public:
+    // The largest number of variables; each then gets an 8-bit field.
+    static const int MAX_VARIABLES = 8;
+
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates a zero polynomial in
+    // the given number of variables.
+    //
+    // Pre: The number of variables must be between 1 and MAX_VARIABLES.
+    //
+    // Post: A zero polynomial exists. A number of variables out of range is
+    // moved to the nearest end of the range.
+    //
+    // Parameter: variables, which is the number of variables.
+    explicit MPoly(int variables = 1);
+
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates a polynomial in the
+    // given number of variables from a polynomial in one of them.
+    //
+    // Pre: The number of variables must be between 1 and MAX_VARIABLES, and the
+    // variable must be below the number of variables.
+    //
+    // Post: A polynomial whose terms are the terms of the given polynomial in
+    // the given variable exists.
+    //
+    // Parameter: univariate, which is the polynomial to convert.
+    //
+    // Parameter: variables, which is the number of variables.
+    //
+    // Parameter: variable, which is the variable that x becomes.
+    MPoly(const Poly& univariate, int variables = 1, int variable = 0);
+
+    // -----------------------------getVariables-----------------------------------
+    // Description: The method getVariables returns the number of variables.
+    //
+    // Return: The number of variables.
+    int getVariables() const;
+
+    // -----------------------------getTermCount-----------------------------------
+    // Description: The method getTermCount returns the number of nonzero terms.
+    //
+    // Return: The number of nonzero terms.
+    size_t getTermCount() const;
+
+    // ---------------------------getMaxExponent-----------------------------------
+    // Description: The method getMaxExponent returns the largest exponent that
+    // one variable can have.
+    //
+    // Return: The largest exponent.
+    int getMaxExponent() const;
+
+    // --------------------------------getCoeff------------------------------------
+    // Description: The method getCoeff returns the coefficient of the given
+    // monomial by binary search.
+    //
+    // Parameter: exponents, which holds one exponent for each variable.
+    //
+    // Return: The coefficient; zero if the monomial is not a term or an
+    // exponent is out of range.
+    int getCoeff(const std::vector<int>& exponents) const;
+
+    // --------------------------------setCoeff------------------------------------
+    // Description: The method setCoeff sets the coefficient of the given
+    // monomial. A monomial above every current term is appended in O(1), so
+    // setting terms in increasing order builds a polynomial in linear time;
+    // any other monomial is inserted in O(n).
+    //
+    // Pre: There must be one exponent for each variable, and every exponent
+    // must be between zero and getMaxExponent().
+    //
+    // Post: The coefficient of the monomial becomes the given integer. If an
+    // exponent is out of range, this method does nothing.
+    //
+    // Parameter: coefficient, which is the new coefficient.
+    //
+    // Parameter: exponents, which holds one exponent for each variable.
+    void setCoeff(int coefficient, const std::vector<int>& exponents);
+
+    // ------------------------------operator + -----------------------------------
+    // Description: The method operator+ adds this polynomial and the polynomial
+    // on the right hand side by merging their sorted terms in O(n + m) time.
+    //
+    // Pre: Both polynomials must have the same number of variables.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the addition.
+    MPoly operator+(const MPoly& rhs) const;
+
+    // ------------------------------operator - -----------------------------------
+    // Description: The method operator- subtracts the polynomial on the right
+    // hand side from this polynomial by merging their sorted terms in O(n + m)
+    // time.
+    //
+    // Pre: Both polynomials must have the same number of variables.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the subtraction.
+    MPoly operator-(const MPoly& rhs) const;
+
+    // ------------------------------operator * -----------------------------------
+    // Description: The method operator* multiplies this polynomial by the
+    // polynomial on the right hand side. A heap holds the next product of
+    // every term of the smaller polynomial, so the products come out in
+    // increasing order and like terms are combined as they are produced. This
+    // takes O(nm log n) time and O(n) memory beyond the result, where n is the
+    // number of terms in the smaller polynomial.
+    //
+    // Pre: Both polynomials must have the same number of variables. No
+    // exponent of the product may exceed getMaxExponent().
+    //
+    // Post: Both polynomials do not change. If an exponent of the product
+    // overflows its field, this method returns a zero polynomial.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Return: A new polynomial that is the result of the multiplication.
+    MPoly operator*(const MPoly& rhs) const;
+
+    // ------------------------------operator == ----------------------------------
+    // Description: The method operator== reports whether this polynomial and
+    // the polynomial on the right hand side have the same terms.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Return: True if the two polynomials are the same; false otherwise.
+    bool operator==(const MPoly& rhs) const;
+
+    // ------------------------------operator != ----------------------------------
+    // Description: The method operator!= reports whether this polynomial and
+    // the polynomial on the right hand side have different terms.
+    //
+    // Parameter: rhs, which is the polynomial on the right hand side.
+    //
+    // Return: True if the two polynomials are different; false otherwise.
+    bool operator!=(const MPoly& rhs) const;
+
+    // --------------------------------toPoly--------------------------------------
+    // Description: The method toPoly converts this polynomial to a polynomial
+    // in the given variable.
+    //
+    // Pre: No other variable may appear in a term.
+    //
+    // Post: This polynomial does not change.
+    //
+    // Parameter: variable, which is the variable that becomes x.
+    //
+    // Parameter: result, which receives the converted polynomial.
+    //
+    // Return: True if only the given variable appears, with no exponent above
+    // getMaxExponent(); false otherwise, in which case the result does not
+    // change.
+    bool toPoly(int variable, Poly& result) const;
+
+    // ------------------------------operator << ----------------------------------
+    // Description: The method operator<< writes the terms of a polynomial from
+    // the highest monomial to the lowest, naming the variables x0, x1, and so
+    // on, in the same form as the Poly class.
+    //
+    // Parameter: lhs, which is the ostream object.
+    //
+    // Parameter: rhs, which is the polynomial to write.
+    //
+    // Return: A reference to the ostream object.
+    friend std::ostream& operator<<(std::ostream& lhs, const MPoly& rhs);
+};
@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
+#include "modpoly.h"
 #include "poly.h"
+#include "polystats.h"
 
 // -------------------------------- poly.cpp ----------------------------------
 // Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
@@ -25,6 +30,7 @@
 // Post: A zero polynomial exists.
 Poly::Poly() : poly(new int[1]), max(1)
 {
+    POLY_STATS_ALLOCATE(CONSTRUCTOR, 1);
     poly[0] = 0;
 } // end of the default constructor
 
@@ -39,6 +45,7 @@ Poly::Poly() : poly(new int[1]), max(1)
 // create.
 Poly::Poly(int coefficient) : poly(new int[1]), max(1)
 {
+    POLY_STATS_ALLOCATE(CONSTRUCTOR, 1);
     poly[0] = coefficient;
 } // end of this parametrized constructor
 
@@ -63,6 +70,7 @@ Poly::Poly(int coefficient, int degree)
         degree = 0;
     }
     poly = new int[degree + 1];
+    POLY_STATS_ALLOCATE(CONSTRUCTOR, degree + 1);
     poly[degree] = coefficient;
     max = degree + 1;
 
@@ -82,6 +90,7 @@ Poly::Poly(int coefficient, int degree)
 // Parameter: other, which is another polynomial that this polynomial copies.
 Poly::Poly(const Poly& other) : poly(new int[other.max]), max(other.max)
 {
+    POLY_STATS_ALLOCATE(CONSTRUCTOR, other.max);
     operator=(other);
 } // end of the copy constructor
 
@@ -109,6 +118,7 @@ Poly::~Poly()
 // Return: A new polynomial that is the result of the addition.
 Poly Poly::operator+(const Poly& rhs) const
 {
+    POLY_STATS_TIME(ADD);
     if (max >= rhs.max)
     {
         // Make the result be this polynomial.
@@ -148,6 +158,7 @@ Poly Poly::operator+(const Poly& rhs) const
 // Return: A new polynomial that is the result of the subtraction.
 Poly Poly::operator-(const Poly& rhs) const
 {
+    POLY_STATS_TIME(SUBTRACT);
     if (max >= rhs.max)
     {
         // Make the result be this polynomial.
@@ -191,6 +202,9 @@ Poly Poly::operator-(const Poly& rhs) const
 // Return: A new polynomial that is the result of the multiplication.
 Poly Poly::operator*(const Poly& rhs) const
 {
+    POLY_STATS_TIME(MULTIPLY);
+    POLY_STATS_MULTIPLY(max - 1, rhs.max - 1);
+
     // Dynamically allocate memory for the result.
     Poly result(0, (max - 1) + (rhs.max - 1));
     
@@ -217,6 +231,7 @@ Poly Poly::operator*(const Poly& rhs) const
 // Return: A reference to this polynomial.
 Poly& Poly::operator=(const Poly& rhs)
 {
+    POLY_STATS_TIME(ASSIGN);
     if (max < rhs.max)
     {
         // Free the original block of memory and dynamically allocate a new
@@ -225,9 +240,11 @@ Poly& Poly::operator=(const Poly& rhs)
         delete[] poly;
         poly = new int[rhs.max];
         max = rhs.max;
+        POLY_STATS_ALLOCATE(ASSIGNMENT, rhs.max);
     }
 
     // Copy the right-hand-side polynomial.
+    POLY_STATS_COPY(rhs.max);
     for (int i = 0; i < rhs.max; i++)
     {
         poly[i] = rhs.poly[i];
@@ -253,6 +270,7 @@ Poly& Poly::operator=(const Poly& rhs)
 // Return: A reference to this polynomial.
 Poly& Poly::operator+=(const Poly& rhs)
 {
+    POLY_STATS_TIME(ADD_ASSIGN);
     if (max >= rhs.max)
     {
         // Perform the addition.
@@ -287,6 +305,7 @@ Poly& Poly::operator+=(const Poly& rhs)
 // Return: A reference to this polynomial.
 Poly& Poly::operator-=(const Poly& rhs)
 {
+    POLY_STATS_TIME(SUBTRACT_ASSIGN);
     if (max >= rhs.max)
     {
         // Perform the subtraction.
@@ -321,6 +340,7 @@ Poly& Poly::operator-=(const Poly& rhs)
 // Return: A reference to this polynomial.
 Poly& Poly::operator*=(const Poly& rhs)
 {
+    POLY_STATS_TIME(MULTIPLY_ASSIGN);
     operator=(operator*(rhs));
     return *this;
 } // end of the method operator*=
@@ -337,6 +357,7 @@ Poly& Poly::operator*=(const Poly& rhs)
 // Return: True if the two polynomials are the same; false otherwise.
 bool Poly::operator==(const Poly& rhs) const
 {
+    POLY_STATS_TIME(EQUAL);
     if (max >= rhs.max)
     {
         // Return false if the two polynomials have different coefficients for
@@ -391,6 +412,7 @@ bool Poly::operator==(const Poly& rhs) const
 // Return: True if the two polynomials are different; false otherwise.
 bool Poly::operator!=(const Poly& rhs) const
 {
+    POLY_STATS_TIME(NOT_EQUAL);
     return !operator==(rhs);
 } // end of the method operator!=
 
@@ -408,6 +430,7 @@ bool Poly::operator!=(const Poly& rhs) const
 // Return: A reference to the ostream object.
 std::ostream& operator<<(std::ostream& lhs, const Poly& rhs)
 {
+    POLY_STATS_TIME(WRITE);
     bool isZero = true;
     int index = rhs.max - 1;
 
@@ -520,6 +543,7 @@ int Poly::getCoeff(int power) const
 // Return: A reference to the istream object.
 std::istream& operator>>(std::istream& lhs, Poly& rhs)
 {
+    POLY_STATS_TIME(READ);
     int coefficient, power;
     lhs >> coefficient >> power;
 
@@ -554,6 +578,8 @@ void Poly::setCoeff(int coefficient, int power)
         int previousMax = max;
         poly = new int[power + 1];
         max = power + 1;
+        POLY_STATS_ALLOCATE(SET_COEFF, power + 1);
+        POLY_STATS_COPY(previousMax);
 
         for (int i = 0; i < previousMax; i++)
         {
@@ -572,4 +598,277 @@ void Poly::setCoeff(int coefficient, int power)
     {
         poly[power] = coefficient;
     }
-} // end of the method setCoeff
\ No newline at end of file
+} // end of the method setCoeff
+
+// -------------------------------taylorShift----------------------------------
+// Description: The method taylorShift replaces x with x + shift in this
+// polynomial. It runs synthetic division in place, which takes O(n^2)
+// time, for a small degree and a factorial convolution modulo both primes
+// of the ModPoly class, which takes O(n log n) time, for a large degree.
+//
+// Pre: Every coefficient of the shifted polynomial must fit in an int.
+//
+// Post: This polynomial becomes p(x + shift).
+//
+// Parameter: shift, which is the amount to shift by.
+void Poly::taylorShift(int shift)
+{
+    int n = degree();
+    if (n <= 0 || shift == 0)
+    {
+        return;
+    }
+
+    if (n < SHIFT_THRESHOLD)
+    {
+        // Unsigned arithmetic wraps like the coefficients would if they were
+        // computed one product at a time, and it gives the exact answer
+        // whenever that answer fits in an int.
+        unsigned* coeff = reinterpret_cast<unsigned*>(poly);
+        unsigned amount = static_cast<unsigned>(shift);
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = n - 1; j >= i; j--)
+            {
+                coeff[j] += amount * coeff[j + 1];
+            }
+        }
+        return;
+    }
+
+    Poly result = fromResidues(
+        toModPoly(ModPoly::PRIME_A).taylorShift(ModPoly::reduce(shift, ModPoly::PRIME_A)),
+        toModPoly(ModPoly::PRIME_B).taylorShift(ModPoly::reduce(shift, ModPoly::PRIME_B)));
+    *this = result;
+} // end of the method taylorShift
+
+// ---------------------------------compose------------------------------------
+// Description: The method compose substitutes the inner polynomial for x in
+// the outer polynomial. It uses Horner's rule on two reused buffers when
+// the result is small and a divide-and-conquer composition on the fast
+// multiplication of the ModPoly class when the result is large.
+//
+// Pre: Every coefficient of the composition must fit in an int.
+//
+// Post: Both polynomials do not change.
+//
+// Parameter: outer, which is the polynomial to evaluate.
+//
+// Parameter: inner, which is the polynomial to substitute for x.
+//
+// Return: A new polynomial that is outer(inner(x)).
+Poly compose(const Poly& outer, const Poly& inner)
+{
+    int n = outer.degree();
+    int m = inner.degree();
+    if (n <= 0)
+    {
+        return Poly(n < 0 ? 0 : outer.poly[0]);
+    }
+    if (m <= 0)
+    {
+        // A constant inner polynomial makes the result a single value.
+        unsigned point = static_cast<unsigned>(m < 0 ? 0 : inner.poly[0]);
+        unsigned value = 0;
+        for (int i = n; i >= 0; i--)
+        {
+            value = value * point + static_cast<unsigned>(outer.poly[i]);
+        }
+        return Poly(static_cast<int>(value));
+    }
+
+    long long resultDegree = static_cast<long long>(n) * m;
+    if (resultDegree < Poly::COMPOSE_THRESHOLD)
+    {
+        // Horner's rule: the partial result has degree k * m after k steps,
+        // so each step multiplies into the other buffer and swaps.
+        std::vector<unsigned> current(resultDegree + 1, 0);
+        std::vector<unsigned> next(resultDegree + 1, 0);
+        current[0] = static_cast<unsigned>(outer.poly[n]);
+        int currentDegree = 0;
+        for (int i = n - 1; i >= 0; i--)
+        {
+            int nextDegree = currentDegree + m;
+            std::fill(next.begin(), next.begin() + nextDegree + 1, 0u);
+            for (int j = 0; j <= currentDegree; j++)
+            {
+                unsigned factor = current[j];
+                for (int k = 0; k <= m; k++)
+                {
+                    next[j + k] += factor * static_cast<unsigned>(inner.poly[k]);
+                }
+            }
+            next[0] += static_cast<unsigned>(outer.poly[i]);
+            current.swap(next);
+            currentDegree = nextDegree;
+        }
+
+        Poly result(0, static_cast<int>(resultDegree));
+        for (int i = 0; i <= resultDegree; i++)
+        {
+            result.poly[i] = static_cast<int>(current[i]);
+        }
+        return result;
+    }
+
+    return Poly::fromResidues(
+        outer.toModPoly(ModPoly::PRIME_A).compose(inner.toModPoly(ModPoly::PRIME_A)),
+        outer.toModPoly(ModPoly::PRIME_B).compose(inner.toModPoly(ModPoly::PRIME_B)));
+} // end of the method compose
+
+// ------------------------------interpolate-----------------------------------
+// Description: The method interpolate builds the polynomial of degree less
+// than n that passes through the given n points. It uses Newton's divided
+// differences, which take O(n^2) time, for a small number of points and the
+// subproduct tree, which takes O(n log^2 n) time, for a large number of
+// points.
+//
+// Pre: The x values of the points must be distinct modulo both primes of the
+// ModPoly class. The interpolating polynomial must have integer coefficients
+// that fit in an int.
+//
+// Post: This method returns the interpolating polynomial. If two points
+// share an x value, this method returns a zero polynomial.
+//
+// Parameter: points, which are the (x, y) pairs to interpolate.
+//
+// Return: The polynomial that passes through the given points.
+Poly Poly::interpolate(const std::vector<std::pair<int, int>>& points)
+{
+    return interpolateMod(points, static_cast<int>(points.size()) >= INTERPOLATION_THRESHOLD);
+} // end of the method interpolate
+
+// ---------------------------interpolateNewton--------------------------------
+// Description: The method interpolateNewton builds the polynomial that
+// passes through the given points with Newton's divided differences in
+// O(n^2) time.
+//
+// Pre: The x values of the points must be distinct modulo both primes of the
+// ModPoly class. The interpolating polynomial must have integer coefficients
+// that fit in an int.
+//
+// Post: This method returns the interpolating polynomial. If two points
+// share an x value, this method returns a zero polynomial.
+//
+// Parameter: points, which are the (x, y) pairs to interpolate.
+//
+// Return: The polynomial that passes through the given points.
+Poly Poly::interpolateNewton(const std::vector<std::pair<int, int>>& points)
+{
+    return interpolateMod(points, false);
+} // end of the method interpolateNewton
+
+// ----------------------------interpolateFast---------------------------------
+// Description: The method interpolateFast builds the polynomial that passes
+// through the given points with a subproduct tree in O(n log^2 n) time.
+//
+// Pre: The x values of the points must be distinct modulo both primes of the
+// ModPoly class. The interpolating polynomial must have integer coefficients
+// that fit in an int.
+//
+// Post: This method returns the interpolating polynomial. If two points
+// share an x value, this method returns a zero polynomial.
+//
+// Parameter: points, which are the (x, y) pairs to interpolate.
+//
+// Return: The polynomial that passes through the given points.
+Poly Poly::interpolateFast(const std::vector<std::pair<int, int>>& points)
+{
+    return interpolateMod(points, true);
+} // end of the method interpolateFast
+
+// ------------------------------fromResidues----------------------------------
+// Description: The method fromResidues builds a polynomial from the same
+// polynomial reduced modulo ModPoly::PRIME_A and ModPoly::PRIME_B.
+//
+// Pre: Every coefficient of the polynomial to recover must fit in an int.
+//
+// Parameter: residuesA, which is the polynomial modulo ModPoly::PRIME_A.
+//
+// Parameter: residuesB, which is the polynomial modulo ModPoly::PRIME_B.
+//
+// Return: The polynomial whose coefficients have the given residues.
+Poly Poly::fromResidues(const ModPoly& residuesA, const ModPoly& residuesB)
+{
+    int degree = residuesA.getDegree() > residuesB.getDegree() ?
+                 residuesA.getDegree() : residuesB.getDegree();
+    if (degree < 0)
+    {
+        return Poly();
+    }
+
+    Poly result(0, degree);
+    for (int i = 0; i <= degree; i++)
+    {
+        result.poly[i] = ModPoly::combine(residuesA.getCoeff(i), residuesB.getCoeff(i));
+    }
+    return result;
+} // end of the method fromResidues
+
+// ---------------------------------degree-------------------------------------
+// Description: The method degree returns the highest power whose
+// coefficient is not zero.
+//
+// Return: The degree of this polynomial; -1 for a zero polynomial.
+int Poly::degree() const
+{
+    int power = max - 1;
+    while (power >= 0 && poly[power] == 0)
+    {
+        power--;
+    }
+    return power;
+} // end of the method degree
+
+// -------------------------------toModPoly------------------------------------
+// Description: The method toModPoly reduces every coefficient of this
+// polynomial modulo the given prime.
+//
+// Parameter: modulus, which is the prime to reduce by.
+//
+// Return: This polynomial as a ModPoly.
+ModPoly Poly::toModPoly(unsigned modulus) const
+{
+    std::vector<unsigned> residues(max);
+    for (int i = 0; i < max; i++)
+    {
+        residues[i] = ModPoly::reduce(poly[i], modulus);
+    }
+    return ModPoly(modulus, residues);
+} // end of the method toModPoly
+
+// -----------------------------interpolateMod---------------------------------
+// Description: The method interpolateMod reduces the given points modulo
+// both primes, interpolates over each prime with the chosen method, and
+// combines the two results.
+//
+// Parameter: points, which are the (x, y) pairs to interpolate.
+//
+// Parameter: fast, which selects the subproduct tree over Newton's method.
+//
+// Return: The interpolating polynomial; a zero polynomial if two points
+// share an x value.
+Poly Poly::interpolateMod(const std::vector<std::pair<int, int>>& points, bool fast)
+{
+    const unsigned primes[2] = { ModPoly::PRIME_A, ModPoly::PRIME_B };
+    ModPoly residues[2] = { ModPoly(ModPoly::PRIME_A), ModPoly(ModPoly::PRIME_B) };
+    std::vector<unsigned> x(points.size());
+    std::vector<unsigned> y(points.size());
+
+    for (int k = 0; k < 2; k++)
+    {
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            x[i] = ModPoly::reduce(points[i].first, primes[k]);
+            y[i] = ModPoly::reduce(points[i].second, primes[k]);
+        }
+
+        bool distinct = fast ? ModPoly::interpolate(x, y, residues[k]) :
+                               ModPoly::interpolateNewton(x, y, residues[k]);
+        if (!distinct)
+        {
+            return Poly();
+        }
+    }
+    return fromResidues(residues[0], residues[1]);
+} // end of the method interpolateMod
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <iostream>
+#include <utility>
+#include <vector>
 
 // -------------------------------- poly.h ------------------------------------
 // Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
@@ -17,8 +19,13 @@
 //
 // Note: The polynomial that the Poly class represents cannot have negative
 // exponents.
+//
+// Note: When the program is compiled with POLY_INSTRUMENT defined, the Poly
+// class reports its allocations, coefficient copies, multiplications and
+// operator times to the PolyStats class.
 // ----------------------------------------------------------------------------
 
+class ModPoly;
 
 class Poly
 {
@@ -27,6 +34,60 @@ private:
     int* poly;
     int max;
 
+    // The MPoly class converts to and from the coefficient array directly.
+    friend class MPoly;
+
+    // The method interpolate uses Newton's divided differences below this
+    // number of points and the subproduct tree from this number of points.
+    static const int INTERPOLATION_THRESHOLD = 384;
+
+    // The method taylorShift uses synthetic division below this degree, and
+    // the method compose uses Horner's rule below this degree of the result.
+    static const int SHIFT_THRESHOLD = 640;
+    static const int COMPOSE_THRESHOLD = 1536;
+
+    // ---------------------------------degree-------------------------------------
+    // Description: The method degree returns the highest power whose
+    // coefficient is not zero.
+    //
+    // Return: The degree of this polynomial; -1 for a zero polynomial.
+    int degree() const;
+
+    // -------------------------------toModPoly------------------------------------
+    // Description: The method toModPoly reduces every coefficient of this
+    // polynomial modulo the given prime.
+    //
+    // Parameter: modulus, which is the prime to reduce by.
+    //
+    // Return: This polynomial as a ModPoly.
+    ModPoly toModPoly(unsigned modulus) const;
+
+    // ------------------------------fromResidues----------------------------------
+    // Description: The method fromResidues builds a polynomial from the same
+    // polynomial reduced modulo ModPoly::PRIME_A and ModPoly::PRIME_B.
+    //
+    // Pre: Every coefficient of the polynomial to recover must fit in an int.
+    //
+    // Parameter: residuesA, which is the polynomial modulo ModPoly::PRIME_A.
+    //
+    // Parameter: residuesB, which is the polynomial modulo ModPoly::PRIME_B.
+    //
+    // Return: The polynomial whose coefficients have the given residues.
+    static Poly fromResidues(const ModPoly& residuesA, const ModPoly& residuesB);
+
+    // -----------------------------interpolateMod---------------------------------
+    // Description: The method interpolateMod reduces the given points modulo
+    // both primes, interpolates over each prime with the chosen method, and
+    // combines the two results.
+    //
+    // Parameter: points, which are the (x, y) pairs to interpolate.
+    //
+    // Parameter: fast, which selects the subproduct tree over Newton's method.
+    //
+    // Return: The interpolating polynomial; a zero polynomial if two points
+    // share an x value.
+    static Poly interpolateMod(const std::vector<std::pair<int, int>>& points, bool fast);
+
 public:
     // ---------------------------Default Constructor------------------------------
     // Description: The default constructor creates a zero polynomial.
@@ -254,4 +315,86 @@ public:
     //
     // Parameter: power, which is the power that should have the new coefficient.
     void setCoeff(int coefficient, int power);
+
+    // -------------------------------taylorShift----------------------------------
+    // Description: The method taylorShift replaces x with x + shift in this
+    // polynomial. It runs synthetic division in place, which takes O(n^2)
+    // time, for a small degree and a factorial convolution modulo both primes
+    // of the ModPoly class, which takes O(n log n) time, for a large degree.
+    //
+    // Pre: Every coefficient of the shifted polynomial must fit in an int.
+    //
+    // Post: This polynomial becomes p(x + shift).
+    //
+    // Parameter: shift, which is the amount to shift by.
+    void taylorShift(int shift);
+
+    // ---------------------------------compose------------------------------------
+    // Description: The method compose substitutes the inner polynomial for x in
+    // the outer polynomial. It uses Horner's rule on two reused buffers when
+    // the result is small and a divide-and-conquer composition on the fast
+    // multiplication of the ModPoly class when the result is large.
+    //
+    // Pre: Every coefficient of the composition must fit in an int.
+    //
+    // Post: Both polynomials do not change.
+    //
+    // Parameter: outer, which is the polynomial to evaluate.
+    //
+    // Parameter: inner, which is the polynomial to substitute for x.
+    //
+    // Return: A new polynomial that is outer(inner(x)).
+    friend Poly compose(const Poly& outer, const Poly& inner);
+
+    // ------------------------------interpolate-----------------------------------
+    // Description: The method interpolate builds the polynomial of degree less
+    // than n that passes through the given n points. It uses Newton's divided
+    // differences, which take O(n^2) time, for a small number of points and the
+    // subproduct tree, which takes O(n log^2 n) time, for a large number of
+    // points.
+    //
+    // Pre: The x values of the points must be distinct modulo both primes of the
+    // ModPoly class. The interpolating polynomial must have integer coefficients
+    // that fit in an int.
+    //
+    // Post: This method returns the interpolating polynomial. If two points
+    // share an x value, this method returns a zero polynomial.
+    //
+    // Parameter: points, which are the (x, y) pairs to interpolate.
+    //
+    // Return: The polynomial that passes through the given points.
+    static Poly interpolate(const std::vector<std::pair<int, int>>& points);
+
+    // ---------------------------interpolateNewton--------------------------------
+    // Description: The method interpolateNewton builds the polynomial that
+    // passes through the given points with Newton's divided differences in
+    // O(n^2) time.
+    //
+    // Pre: The x values of the points must be distinct modulo both primes of the
+    // ModPoly class. The interpolating polynomial must have integer coefficients
+    // that fit in an int.
+    //
+    // Post: This method returns the interpolating polynomial. If two points
+    // share an x value, this method returns a zero polynomial.
+    //
+    // Parameter: points, which are the (x, y) pairs to interpolate.
+    //
+    // Return: The polynomial that passes through the given points.
+    static Poly interpolateNewton(const std::vector<std::pair<int, int>>& points);
+
+    // ----------------------------interpolateFast---------------------------------
+    // Description: The method interpolateFast builds the polynomial that passes
+    // through the given points with a subproduct tree in O(n log^2 n) time.
+    //
+    // Pre: The x values of the points must be distinct modulo both primes of the
+    // ModPoly class. The interpolating polynomial must have integer coefficients
+    // that fit in an int.
+    //
+    // Post: This method returns the interpolating polynomial. If two points
+    // share an x value, this method returns a zero polynomial.
+    //
+    // Parameter: points, which are the (x, y) pairs to interpolate.
+    //
+    // Return: The polynomial that passes through the given points.
+    static Poly interpolateFast(const std::vector<std::pair<int, int>>& points);
 };
\ No newline at end of file
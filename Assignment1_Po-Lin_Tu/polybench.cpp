@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "poly.h"
+using namespace std;
+
+// ------------------------------ polybench.cpp -------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file benchmarks the Poly class. It sweeps the degree from 1
+// to 10^7 over dense and sparse polynomials and times the constructors, the
+// arithmetic, compound and comparison operators, getCoeff and setCoeff in
+// ascending and random order, operator>> and operator<<, and compose and
+// taylorShift against Horner's rule over Poly objects. Every result reports
+// the time, heap allocations and bytes per operation, and the whole run is
+// written to standard output as one JSON object.
+//
+// Usage: g++ -std=c++17 -O2 polybench.cpp poly.cpp modpoly.cpp -o polybench
+//        polybench [maximum degree] > results.json
+//
+// Note: A case whose estimated work is more than WORK_LIMIT basic steps,
+// such as the quadratic multiplication at a high degree, is written with
+// "skipped": true instead of being run. So are the Taylor shift cases above
+// SHIFT_DEGREE_LIMIT, whose results would not fit in an int.
+// ----------------------------------------------------------------------------
+
+// The benchmark replaces the global allocation functions, so these counters
+// see every buffer that the Poly class and the standard library allocate.
+static unsigned long long allocationCount = 0;
+static unsigned long long allocationBytes = 0;
+
+void* operator new(size_t size)
+{
+    allocationCount++;
+    allocationBytes += size;
+    void* block = malloc(size == 0 ? 1 : size);
+    if (block == nullptr)
+    {
+        throw bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete[](void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    free(block);
+}
+
+void operator delete[](void* block, size_t) noexcept
+{
+    free(block);
+}
+
+// Cases whose estimated work exceeds this number of steps are skipped.
+static const double WORK_LIMIT = 2e9;
+
+// A case is repeated until it has run for at least this many seconds.
+static const double TARGET_SECONDS = 0.05;
+
+// One nonzero coefficient in this many is kept in a sparse polynomial.
+static const int SPARSE_STRIDE = 64;
+
+// Shifting by one turns a coefficient of -1, 0 or 1 at power i into at most
+// C(i, k) at power k, so every coefficient of a shifted polynomial of degree
+// d is at most C(d + 1, k + 1), which fits in an int up to this degree.
+static const int SHIFT_DEGREE_LIMIT = 32;
+
+// The results written so far, which decides whether a comma is needed.
+static int resultCount = 0;
+
+// ------------------------------makeCoefficients-------------------------------
+// Description: The function makeCoefficients lists the (coefficient, power)
+// pairs of a polynomial of the given degree in ascending power.
+//
+// Parameter: degree, which is the degree of the polynomial.
+//
+// Parameter: sparse, which keeps one power in SPARSE_STRIDE when true.
+//
+// Parameter: random, which is the generator for the coefficients.
+//
+// Return: The pairs; the highest power is always present.
+vector<pair<int, int>> makeCoefficients(int degree, bool sparse, mt19937& random)
+{
+    vector<pair<int, int>> terms;
+    int stride = sparse ? SPARSE_STRIDE : 1;
+    for (int power = 0; power <= degree; power += stride)
+    {
+        terms.push_back(make_pair(static_cast<int>(random() % 9) + 1, power));
+    }
+    if (terms.back().second != degree)
+    {
+        terms.push_back(make_pair(1, degree));
+    }
+    return terms;
+} // end of the function makeCoefficients
+
+// ---------------------------------makePoly-----------------------------------
+// Description: The function makePoly builds a polynomial from its pairs.
+//
+// Parameter: terms, which are the (coefficient, power) pairs.
+//
+// Return: The polynomial.
+Poly makePoly(const vector<pair<int, int>>& terms)
+{
+    Poly result(0, terms.back().second);
+    for (const pair<int, int>& term : terms)
+    {
+        result.setCoeff(term.first, term.second);
+    }
+    return result;
+} // end of the function makePoly
+
+// ---------------------------------writeSkip----------------------------------
+// Description: The function writeSkip writes a case that was not run.
+void writeSkip(const string& name, int degree, const string& fill, const string& order)
+{
+    cout << (resultCount++ == 0 ? "\n" : ",\n")
+         << "    {\"name\": \"" << name << "\", \"degree\": " << degree
+         << ", \"fill\": \"" << fill << "\", \"order\": \"" << order
+         << "\", \"skipped\": true}";
+} // end of the function writeSkip
+
+// ----------------------------------measure-----------------------------------
+// Description: The function measure runs a case enough times to fill
+// TARGET_SECONDS and writes its time, allocations and bytes per operation.
+//
+// Parameter: name, degree, fill and order, which identify the case.
+//
+// Parameter: work, which is the estimated number of steps in one run.
+//
+// Parameter: operations, which is the number of operations in one run.
+//
+// Parameter: body, which runs the case once.
+template<class Body>
+void measure(const string& name, int degree, const string& fill, const string& order,
+             double work, double operations, Body body)
+{
+    if (work > WORK_LIMIT)
+    {
+        writeSkip(name, degree, fill, order);
+        return;
+    }
+
+    // Time one run to choose the number of repetitions.
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    body();
+    double once = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    long long iterations = 1;
+    if (once < TARGET_SECONDS)
+    {
+        iterations = static_cast<long long>(TARGET_SECONDS / max(once, 1e-8));
+        iterations = min(max(iterations, 1LL), 10000000LL);
+    }
+
+    unsigned long long countBefore = allocationCount;
+    unsigned long long bytesBefore = allocationBytes;
+    start = chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; i++)
+    {
+        body();
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double total = operations * iterations;
+
+    cout << (resultCount++ == 0 ? "\n" : ",\n")
+         << "    {\"name\": \"" << name << "\", \"degree\": " << degree
+         << ", \"fill\": \"" << fill << "\", \"order\": \"" << order
+         << "\", \"iterations\": " << iterations
+         << ", \"ns_per_op\": " << elapsed * 1e9 / total
+         << ", \"allocations_per_op\": " << (allocationCount - countBefore) / total
+         << ", \"bytes_per_op\": " << (allocationBytes - bytesBefore) / total << "}";
+} // end of the function measure
+
+// ------------------------------hornerCompose---------------------------------
+// Description: The function hornerCompose substitutes the inner polynomial
+// for x in the outer polynomial with Horner's rule over Poly objects.
+//
+// Parameter: outer, which is the polynomial to evaluate.
+//
+// Parameter: inner, which is the polynomial to substitute for x.
+//
+// Parameter: degree, which is the degree of the outer polynomial.
+//
+// Return: The polynomial outer(inner(x)).
+Poly hornerCompose(const Poly& outer, const Poly& inner, int degree)
+{
+    Poly result(outer.getCoeff(degree));
+    for (int i = degree - 1; i >= 0; i--)
+    {
+        result = result * inner + Poly(outer.getCoeff(i));
+    }
+    return result;
+} // end of the function hornerCompose
+
+// ---------------------------------sweepFill----------------------------------
+// Description: The function sweepFill runs every case for one degree and one
+// fill.
+//
+// Parameter: degree, which is the degree of the polynomials.
+//
+// Parameter: sparse, which selects the sparse fill.
+//
+// Parameter: random, which is the generator for coefficients and orders.
+void sweepFill(int degree, bool sparse, mt19937& random)
+{
+    const string fill = sparse ? "sparse" : "dense";
+    const double n = degree + 1.0;
+    vector<pair<int, int>> terms = makeCoefficients(degree, sparse, random);
+    vector<pair<int, int>> shuffled = terms;
+    shuffle(shuffled.begin(), shuffled.end(), random);
+    const double t = static_cast<double>(terms.size());
+    Poly p = makePoly(terms);
+    Poly q = makePoly(makeCoefficients(degree, sparse, random));
+    Poly same = p;
+    Poly sink;
+    volatile int keep = 0;
+
+    measure("construct_degree", degree, fill, "none", n, 1, [&]() {
+        Poly result(1, degree);
+        keep = result.getCoeff(0);
+    });
+    measure("copy_construct", degree, fill, "none", n, 1, [&]() {
+        Poly result(p);
+        keep = result.getCoeff(0);
+    });
+    measure("add", degree, fill, "none", 2 * n, 1, [&]() { sink = p + q; });
+    measure("subtract", degree, fill, "none", 2 * n, 1, [&]() { sink = p - q; });
+    measure("multiply", degree, fill, "none", n * n, 1, [&]() { sink = p * q; });
+    measure("assign", degree, fill, "none", n, 1, [&]() { sink = p; });
+
+    // The accumulator grows by at most 9 per coefficient and call, which the
+    // repetition limit keeps well inside an int.
+    Poly accumulator = p;
+    measure("add_assign", degree, fill, "none", n, 1, [&]() { accumulator += q; });
+    measure("subtract_assign", degree, fill, "none", n, 1, [&]() { accumulator -= q; });
+
+    // Every run copies p before multiplying, so the copy_construct case
+    // should be subtracted to get the cost of operator*= alone.
+    measure("multiply_assign", degree, fill, "none", n * n, 1, [&]() {
+        Poly result(p);
+        result *= q;
+        keep = result.getCoeff(0);
+    });
+    measure("equal", degree, fill, "none", n, 1, [&]() { keep = (p == same); });
+    measure("not_equal", degree, fill, "none", n, 1, [&]() { keep = (p != same); });
+
+    measure("get_coeff", degree, fill, "ascending", n, n, [&]() {
+        int total = 0;
+        for (int power = 0; power <= degree; power++)
+        {
+            total += p.getCoeff(power);
+        }
+        keep = total;
+    });
+
+    // Building a polynomial in ascending order grows the buffer at every
+    // call, which copies the whole polynomial each time.
+    const pair<string, const vector<pair<int, int>>*> orders[2] =
+    {
+        make_pair(string("ascending"), &terms), make_pair(string("random"), &shuffled)
+    };
+    for (const pair<string, const vector<pair<int, int>>*>& order : orders)
+    {
+        double work = order.first == "ascending" ? t * n / 2 : n * 8;
+        measure("set_coeff", degree, fill, order.first, work, t, [&]() {
+            Poly result;
+            for (const pair<int, int>& term : *order.second)
+            {
+                result.setCoeff(term.first, term.second);
+            }
+            keep = result.getCoeff(0);
+        });
+
+        ostringstream text;
+        for (const pair<int, int>& term : *order.second)
+        {
+            text << term.first << ' ' << term.second << '\n';
+        }
+        text << "-1 -1\n";
+        const string input = text.str();
+        measure("read", degree, fill, order.first, work + 20 * t, 1, [&]() {
+            istringstream in(input);
+            Poly result;
+            in >> result;
+            keep = result.getCoeff(0);
+        });
+    }
+
+    measure("write", degree, fill, "none", 20 * n, 1, [&]() {
+        ostringstream out;
+        out << p;
+        keep = static_cast<int>(out.tellp());
+    });
+
+    // Composing with x^2 and shifting by one, against Horner's rule. The
+    // composition keeps the coefficients of p, and the shift runs on a
+    // polynomial with coefficients of -1, 0 and 1, so that every result fits
+    // in an int and both sides compute the same thing.
+    Poly square(1, 2);
+    // Above its threshold compose runs in O(n log^2 n) time; the constant
+    // below is a rough fit to that growth.
+    const double logN = log2(n);
+    double composeWork = degree < 768 ? 2 * n * n : 8 * n * logN * logN;
+    measure("horner_compose", degree, fill, "none", 2 * n * n, 1, [&]() {
+        sink = hornerCompose(p, square, degree);
+    });
+    measure("compose", degree, fill, "none", composeWork, 1, [&]() {
+        sink = compose(p, square);
+    });
+
+    if (degree > SHIFT_DEGREE_LIMIT)
+    {
+        writeSkip("horner_taylor_shift", degree, fill, "none");
+        writeSkip("taylor_shift", degree, fill, "none");
+        return;
+    }
+    Poly linear(1, 1);
+    linear.setCoeff(1, 0);
+    vector<pair<int, int>> signs = terms;
+    for (pair<int, int>& term : signs)
+    {
+        term.first = term.first % 3 - 1;
+    }
+    signs.back().first = 1;
+    Poly unit = makePoly(signs);
+    measure("horner_taylor_shift", degree, fill, "none", n * n, 1, [&]() {
+        sink = hornerCompose(unit, linear, degree);
+    });
+    measure("taylor_shift", degree, fill, "none", n * n, 1, [&]() {
+        Poly result(unit);
+        result.taylorShift(1);
+        keep = result.getCoeff(0);
+    });
+} // end of the function sweepFill
+
+int main(int argc, char* argv[])
+{
+    int maximumDegree = 10000000;
+    if (argc > 1)
+    {
+        maximumDegree = atoi(argv[1]);
+    }
+
+    mt19937 random(343);
+    cout << "{\n  \"work_limit\": " << WORK_LIMIT << ",\n  \"results\": [";
+
+    volatile int keep = 0;
+    measure("construct_default", 0, "none", "none", 1, 1, [&]() {
+        Poly result;
+        keep = result.getCoeff(0);
+    });
+    measure("construct_constant", 0, "none", "none", 1, 1, [&]() {
+        Poly result(7);
+        keep = result.getCoeff(0);
+    });
+
+    for (long long degree = 1; degree <= maximumDegree; degree *= 10)
+    {
+        sweepFill(static_cast<int>(degree), false, random);
+        sweepFill(static_cast<int>(degree), true, random);
+    }
+
+    cout << "\n  ]\n}" << endl;
+    return 0;
+}
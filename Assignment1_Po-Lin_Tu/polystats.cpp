@@ -0,0 +1,180 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "polystats.h"
+
+// ----------------------------- polystats.cpp --------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the PolyStats class that
+// counts what the Poly class does. Each thread has its own counters.
+// ----------------------------------------------------------------------------
+
+// The counters of the calling thread and whether it is counting.
+static thread_local PolyStats::Counters counters = {};
+static thread_local bool counting = true;
+
+static const char* const SITE_NAMES[PolyStats::SITE_COUNT] =
+{
+    "constructor", "operator=", "setCoeff"
+};
+
+static const char* const OPERATOR_NAMES[PolyStats::OPERATOR_COUNT] =
+{
+    "operator+", "operator-", "operator*", "operator=", "operator+=",
+    "operator-=", "operator*=", "operator==", "operator!=", "operator<<",
+    "operator>>"
+};
+
+// ---------------------------------Timer--------------------------------------
+// Description: The constructor of a Timer starts timing the given operator.
+PolyStats::Timer::Timer(Operator op) : op(op), start(std::chrono::steady_clock::now())
+{
+} // end of the constructor of the Timer
+
+// ---------------------------------~Timer-------------------------------------
+// Description: The destructor of a Timer adds one call and the elapsed time
+// to its operator.
+PolyStats::Timer::~Timer()
+{
+    if (counting)
+    {
+        std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+        counters.calls[op]++;
+        counters.nanoseconds[op] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+} // end of the destructor of the Timer
+
+// -----------------------------recordAllocation-------------------------------
+// Description: The method recordAllocation counts one buffer of the given
+// number of coefficients allocated at the given site.
+//
+// Parameter: site, which is where the buffer was allocated.
+//
+// Parameter: coefficients, which is the size of the buffer.
+void PolyStats::recordAllocation(Site site, int coefficients)
+{
+    if (counting)
+    {
+        counters.allocations[site]++;
+        counters.bytes[site] += static_cast<unsigned long long>(coefficients) * sizeof(int);
+    }
+} // end of the method recordAllocation
+
+// -------------------------------recordCopy-----------------------------------
+// Description: The method recordCopy counts coefficients copied from one
+// buffer to another.
+//
+// Parameter: coefficients, which is the number of coefficients copied.
+void PolyStats::recordCopy(int coefficients)
+{
+    if (counting)
+    {
+        counters.coefficientCopies += coefficients;
+    }
+} // end of the method recordCopy
+
+// -----------------------------recordMultiply---------------------------------
+// Description: The method recordMultiply counts one multiplication in the
+// buckets of its operand degrees.
+//
+// Parameter: lhsDegree, which is the degree of the left operand.
+//
+// Parameter: rhsDegree, which is the degree of the right operand.
+void PolyStats::recordMultiply(int lhsDegree, int rhsDegree)
+{
+    if (counting)
+    {
+        counters.multiplies[bucket(lhsDegree)][bucket(rhsDegree)]++;
+    }
+} // end of the method recordMultiply
+
+// -------------------------------setEnabled-----------------------------------
+// Description: The method setEnabled pauses or resumes counting on the
+// calling thread. Counting starts enabled.
+//
+// Parameter: enabled, which is true to count and false to pause.
+void PolyStats::setEnabled(bool enabled)
+{
+    counting = enabled;
+} // end of the method setEnabled
+
+// --------------------------------current-------------------------------------
+// Description: The method current returns the counters of the calling
+// thread.
+//
+// Return: A reference to the counters.
+const PolyStats::Counters& PolyStats::current()
+{
+    return counters;
+} // end of the method current
+
+// ---------------------------------reset--------------------------------------
+// Description: The method reset sets every counter of the calling thread to
+// zero.
+void PolyStats::reset()
+{
+    std::memset(&counters, 0, sizeof(counters));
+} // end of the method reset
+
+// ----------------------------------dump--------------------------------------
+// Description: The method dump writes the counters of the calling thread,
+// leaving out the ones that are zero.
+//
+// Parameter: out, which is the stream to write to.
+void PolyStats::dump(std::ostream& out)
+{
+    out << "allocations:" << std::endl;
+    for (int site = 0; site < SITE_COUNT; site++)
+    {
+        if (counters.allocations[site] != 0)
+        {
+            out << "  " << SITE_NAMES[site] << ": " << counters.allocations[site]
+                << " buffers, " << counters.bytes[site] << " bytes" << std::endl;
+        }
+    }
+    out << "coefficient copies: " << counters.coefficientCopies << std::endl;
+
+    out << "multiplications by operand degree:" << std::endl;
+    for (int lhs = 0; lhs < DEGREE_BUCKETS; lhs++)
+    {
+        for (int rhs = 0; rhs < DEGREE_BUCKETS; rhs++)
+        {
+            if (counters.multiplies[lhs][rhs] != 0)
+            {
+                out << "  [" << (lhs == 0 ? 0 : 1 << (lhs - 1)) << ", " << (1LL << lhs)
+                    << ") x [" << (rhs == 0 ? 0 : 1 << (rhs - 1)) << ", " << (1LL << rhs)
+                    << "): " << counters.multiplies[lhs][rhs] << std::endl;
+            }
+        }
+    }
+
+    out << "operators:" << std::endl;
+    for (int op = 0; op < OPERATOR_COUNT; op++)
+    {
+        if (counters.calls[op] != 0)
+        {
+            out << "  " << OPERATOR_NAMES[op] << ": " << counters.calls[op] << " calls, "
+                << counters.nanoseconds[op] << " ns" << std::endl;
+        }
+    }
+} // end of the method dump
+
+// ---------------------------------bucket-------------------------------------
+// Description: The method bucket returns the degree bucket of a degree.
+//
+// Parameter: degree, which is the degree of an operand.
+//
+// Return: The index of the bucket.
+int PolyStats::bucket(int degree)
+{
+    int index = 0;
+    while (degree > 0 && index < DEGREE_BUCKETS - 1)
+    {
+        degree >>= 1;
+        index++;
+    }
+    return index;
+} // end of the method bucket
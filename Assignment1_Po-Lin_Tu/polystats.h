@@ -0,0 +1,154 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+
+// ------------------------------ polystats.h ---------------------------------
+// Programmer Name: Po-Lin Tu  Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the PolyStats class that counts
+// what the Poly class does: the buffers it allocates and where, the
+// coefficients it copies, the sizes of the polynomials it multiplies, and the
+// time it spends in each operator. The counters belong to the calling thread,
+// so threads never share or lock them.
+//
+// Note: The Poly class only updates the counters when the program is
+// compiled with POLY_INSTRUMENT defined. Otherwise the hooks below expand to
+// nothing and the Poly class runs exactly as before.
+// ----------------------------------------------------------------------------
+
+class PolyStats
+{
+public:
+    // The places where the Poly class allocates a buffer.
+    enum Site
+    {
+        CONSTRUCTOR,
+        ASSIGNMENT,
+        SET_COEFF,
+        SITE_COUNT
+    };
+
+    // The operators whose calls and time are recorded. The time of an
+    // operator includes the operators it calls, so operator*= also counts
+    // toward operator* and operator=, and the copy constructor, which assigns
+    // through operator=, counts toward operator=.
+    enum Operator
+    {
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        ASSIGN,
+        ADD_ASSIGN,
+        SUBTRACT_ASSIGN,
+        MULTIPLY_ASSIGN,
+        EQUAL,
+        NOT_EQUAL,
+        WRITE,
+        READ,
+        OPERATOR_COUNT
+    };
+
+    // A multiplication whose operand has degree d falls in bucket k when
+    // 2^(k-1) <= d < 2^k; a constant falls in bucket 0.
+    static const int DEGREE_BUCKETS = 32;
+
+    struct Counters
+    {
+        unsigned long long allocations[SITE_COUNT];
+        unsigned long long bytes[SITE_COUNT];
+        unsigned long long coefficientCopies;
+        unsigned long long multiplies[DEGREE_BUCKETS][DEGREE_BUCKETS];
+        unsigned long long calls[OPERATOR_COUNT];
+        unsigned long long nanoseconds[OPERATOR_COUNT];
+    };
+
+    // ---------------------------------Timer--------------------------------------
+    // Description: A Timer adds one call and the time until it is destroyed to
+    // the given operator.
+    class Timer
+    {
+    public:
+        explicit Timer(Operator op);
+        ~Timer();
+
+    private:
+        Operator op;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    // -----------------------------recordAllocation-------------------------------
+    // Description: The method recordAllocation counts one buffer of the given
+    // number of coefficients allocated at the given site.
+    //
+    // Parameter: site, which is where the buffer was allocated.
+    //
+    // Parameter: coefficients, which is the size of the buffer.
+    static void recordAllocation(Site site, int coefficients);
+
+    // -------------------------------recordCopy-----------------------------------
+    // Description: The method recordCopy counts coefficients copied from one
+    // buffer to another.
+    //
+    // Parameter: coefficients, which is the number of coefficients copied.
+    static void recordCopy(int coefficients);
+
+    // -----------------------------recordMultiply---------------------------------
+    // Description: The method recordMultiply counts one multiplication in the
+    // buckets of its operand degrees.
+    //
+    // Parameter: lhsDegree, which is the degree of the left operand.
+    //
+    // Parameter: rhsDegree, which is the degree of the right operand.
+    static void recordMultiply(int lhsDegree, int rhsDegree);
+
+    // -------------------------------setEnabled-----------------------------------
+    // Description: The method setEnabled pauses or resumes counting on the
+    // calling thread. Counting starts enabled.
+    //
+    // Parameter: enabled, which is true to count and false to pause.
+    static void setEnabled(bool enabled);
+
+    // --------------------------------current-------------------------------------
+    // Description: The method current returns the counters of the calling
+    // thread.
+    //
+    // Return: A reference to the counters.
+    static const Counters& current();
+
+    // ---------------------------------reset--------------------------------------
+    // Description: The method reset sets every counter of the calling thread to
+    // zero.
+    static void reset();
+
+    // ----------------------------------dump--------------------------------------
+    // Description: The method dump writes the counters of the calling thread,
+    // leaving out the ones that are zero.
+    //
+    // Parameter: out, which is the stream to write to.
+    static void dump(std::ostream& out);
+
+    // ---------------------------------bucket-------------------------------------
+    // Description: The method bucket returns the degree bucket of a degree.
+    //
+    // Parameter: degree, which is the degree of an operand.
+    //
+    // Return: The index of the bucket.
+    static int bucket(int degree);
+};
+
+#ifdef POLY_INSTRUMENT
+#define POLY_STATS_ALLOCATE(site, coefficients) \
+    PolyStats::recordAllocation(PolyStats::site, coefficients)
+#define POLY_STATS_COPY(coefficients) PolyStats::recordCopy(coefficients)
+#define POLY_STATS_MULTIPLY(lhsDegree, rhsDegree) \
+    PolyStats::recordMultiply(lhsDegree, rhsDegree)
+#define POLY_STATS_TIME(op) PolyStats::Timer polyStatsTimer(PolyStats::op)
+#else
+#define POLY_STATS_ALLOCATE(site, coefficients) ((void)0)
+#define POLY_STATS_COPY(coefficients) ((void)0)
+#define POLY_STATS_MULTIPLY(lhsDegree, rhsDegree) ((void)0)
+#define POLY_STATS_TIME(op) ((void)0)
+#endif
@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <climits>
 #include <iostream>
+#include <new>
+#include <thread>
+#include <utility>
 #include "bintree.h"
+#include "staticindex.h"
+#include "treeformat.h"
 
 // ------------------------------ bintree.cpp ---------------------------------
 // Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
@@ -18,16 +25,168 @@
 // created from a sorted array.
 // ----------------------------------------------------------------------------
 
+// -----------------------------summarizeLexical-------------------------------
+// Description: The function summarizeLexical packs the first eight bytes of
+// the string, the first byte highest and zeros past the end. The bytes are
+// taken unsigned, as string::compare takes them.
+static unsigned long long summarizeLexical(std::string_view key)
+{
+    unsigned long long summary = 0;
+    for (size_t i = 0; i < sizeof(summary); i++)
+    {
+        summary <<= 8;
+        if (i < key.size())
+        {
+            summary |= static_cast<unsigned char>(key[i]);
+        }
+    }
+    return summary;
+} // end of the function summarizeLexical
+
+// -----------------------------compareLexical---------------------------------
+// Description: The function compareLexical compares the two strings.
+static int compareLexical(std::string_view lhs, std::string_view rhs)
+{
+    return lhs.compare(rhs);
+} // end of the function compareLexical
+
+// ----------------------------summarizeLength---------------------------------
+// Description: The function summarizeLength returns the length of the string.
+static unsigned long long summarizeLength(std::string_view key)
+{
+    return key.size();
+} // end of the function summarizeLength
+
+// -------------------------------summarizeHash--------------------------------
+// Description: The function summarizeHash returns the 64-bit FNV-1a hash of
+// the string.
+static unsigned long long summarizeHash(std::string_view key)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < key.size(); i++)
+    {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+} // end of the function summarizeHash
+
+// ---------------------------------mixHash------------------------------------
+// Description: The function mixHash scrambles the bits of the given value
+// with the finalizer of SplitMix64, so that every input bit affects every
+// output bit.
+static unsigned long long mixHash(unsigned long long value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+} // end of the function mixHash
+
+// Strings of the same length and strings with the same hash fall back to the
+// order of the strings.
+const BinTree::KeyOrder BinTree::LEXICAL_ORDER = {summarizeLexical, compareLexical};
+const BinTree::KeyOrder BinTree::LENGTH_FIRST_ORDER = {summarizeLength, compareLexical};
+const BinTree::KeyOrder BinTree::HASH_ORDER = {summarizeHash, compareLexical};
+
+// A range with fewer strings than this is sorted, or a subtree with fewer
+// nodes than this is built, by one thread, since starting another one costs
+// more than the work it would take over.
+static const int SERIAL_CUTOFF = 1 << 14;
+
+// ---------------------------------keyLess------------------------------------
+// Description: The function keyLess reports whether the first string comes
+// before the second in the given key order.
+//
+// Parameter: order, which is the key order.
+//
+// Parameter: lhs, which is the first string.
+//
+// Parameter: rhs, which is the second string.
+//
+// Return: True if the first string comes first.
+static bool keyLess(const BinTree::KeyOrder& order, const std::string& lhs, const std::string& rhs)
+{
+    unsigned long long lhsSummary = order.summarize(lhs);
+    unsigned long long rhsSummary = order.summarize(rhs);
+    if (lhsSummary != rhsSummary)
+    {
+        return lhsSummary < rhsSummary;
+    }
+    return order.compare(lhs, rhs) < 0;
+} // end of the function keyLess
+
+// ------------------------------parallelSort----------------------------------
+// Description: The function parallelSort sorts the given range of strings
+// in the given key order. It sorts the two halves at the same time, the
+// first in a new thread, and merges them.
+//
+// Parameter: first, which is the first string of the range.
+//
+// Parameter: last, which is just after the last string of the range.
+//
+// Parameter: order, which is the key order.
+//
+// Parameter: threadCount, which is the number of threads for the range.
+static void parallelSort(std::string* first, std::string* last, const BinTree::KeyOrder& order,
+                         unsigned threadCount)
+{
+    auto less = [&order](const std::string& lhs, const std::string& rhs)
+    {
+        return keyLess(order, lhs, rhs);
+    };
+    if (threadCount < 2 || last - first < SERIAL_CUTOFF)
+    {
+        std::sort(first, last, less);
+        return;
+    }
+
+    std::string* middle = first + (last - first) / 2;
+    std::thread leftHalf(parallelSort, first, middle, std::cref(order), threadCount / 2);
+    parallelSort(middle, last, order, threadCount - threadCount / 2);
+    leftHalf.join();
+    std::inplace_merge(first, middle, last, less);
+} // end of the function parallelSort
+
 
 // ---------------------------Default Constructor------------------------------
-// Description: The default constructor creates an empty tree.
+// Description: The default constructor creates an empty tree that does not
+// rebalance.
 //
 // Post: An empty tree, whose root node is a null pointer, exists.
-BinTree::BinTree() : root(nullptr)
+BinTree::BinTree() : root(nullptr), mode(UNBALANCED), order(LEXICAL_ORDER)
 {
 
 } // end of the default constructor
 
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates an empty tree that
+// rebalances in the given mode.
+//
+// Post: An empty tree, whose root node is a null pointer, exists.
+//
+// Parameter: mode, which is how insert keeps this tree balanced.
+BinTree::BinTree(BalanceMode mode) : root(nullptr), mode(mode), order(LEXICAL_ORDER)
+{
+
+} // end of the parametrized constructor
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: This parametrized constructor creates an empty tree that
+// rebalances in the given mode and sorts its keys in the given order.
+//
+// Post: An empty tree, whose root node is a null pointer, exists.
+//
+// Parameter: mode, which is how insert keeps this tree balanced.
+//
+// Parameter: order, which is the order of the keys in this tree.
+BinTree::BinTree(BalanceMode mode, const KeyOrder& order) : root(nullptr), mode(mode), order(order)
+{
+
+} // end of the parametrized constructor
+
 // ------------------------------Copy Constructor------------------------------
 // Description: The copy constructor copies the given binary search tree and
 // creates a new binary search tree that is the same as the given one.
@@ -35,10 +194,11 @@ BinTree::BinTree() : root(nullptr)
 // Pre: The given tree must be a binary search tree.
 //
 // Post: A new binary search tree that is the same as the given binary search
-// tree exists.
+// tree exists. It has the same structure, balance mode and key order as the
+// given tree.
 //
 // Parameter: other, which is the binary search tree to copy.
-BinTree::BinTree(const BinTree& other) : root(nullptr)
+BinTree::BinTree(const BinTree& other) : root(nullptr), mode(other.mode), order(other.order)
 {
     operator=(other);
 } // end of the copy constructor
@@ -54,6 +214,26 @@ BinTree::~BinTree()
     makeEmpty();
 } // end of the destructor
 
+// ----------------------------getBalanceMode----------------------------------
+// Description: The method getBalanceMode reports how insert keeps this
+// binary search tree balanced.
+//
+// Return: The balance mode of this binary search tree.
+BinTree::BalanceMode BinTree::getBalanceMode() const
+{
+    return mode;
+} // end of the method getBalanceMode
+
+// -----------------------------getKeyOrder------------------------------------
+// Description: The method getKeyOrder reports the order of the keys in this
+// binary search tree.
+//
+// Return: The key order of this binary search tree.
+BinTree::KeyOrder BinTree::getKeyOrder() const
+{
+    return order;
+} // end of the method getKeyOrder
+
 // -------------------------------isEmpty--------------------------------------
 // Description: The method isEmpty reports whether this binary search tree is
 // empty.
@@ -67,31 +247,43 @@ bool BinTree::isEmpty() const
     return root == nullptr;
 } // end of the method isEmpty
 
+// --------------------------------getSize-------------------------------------
+// Description: The method getSize reports the number of node data objects in
+// this binary search tree, which the root node caches.
+//
+// Post: This binary search tree does not change.
+//
+// Return: The number of node data objects.
+int BinTree::getSize() const
+{
+    return sizeOf(root);
+} // end of the method getSize
+
 // -------------------------------makeEmpty------------------------------------
 // Description: The method makeEmpty empties this binary search tree, freeing
-// the memory that is dynamically allocated to each node in this tree.
+// the memory that is dynamically allocated to each node in this tree. The
+// nodes live in the node pool of this tree, so this frees a few chunks
+// instead of every node.
 //
 // Post: This binary search tree is empty (the root node is a null pointer).
 // The dynamically allocated memory is free.
 void BinTree::makeEmpty()
 {
-    // Recursively empty this binary search tree if this binary search tree is
-    // not empty.
-    if (!isEmpty())
-    {
-        emptyHelper(root);
-    }
+    // Destroy every tree node at once by releasing the node pool.
+    root = nullptr;
+    pool.release();
 } // end of the method makeEmpty
 
 // ------------------------------operator = -----------------------------------
 // Description: The method operator= overloads the operator =, assigning the
 // binary search tree on the right-hand side of the operator = to this binary
-// search tree, which is on the left-hand side.
+// search tree, which is on the left-hand side. The tree is copied node for
+// node, and the new nodes are allocated together in one chunk.
 //
 // Pre: The tree on the right-hand side must be a binary search tree.
 //
 // Post: This binary search tree is the same as the one on the right-hand
-// side.
+// side. It has the same structure, balance mode and key order.
 //
 // Parameter: rhs, the binary search tree to assign to this one.
 //
@@ -99,14 +291,17 @@ void BinTree::makeEmpty()
 BinTree& BinTree::operator=(const BinTree& rhs)
 {
     // Do nothing if the assignment is a self-assignment.
-    if (root != rhs.root)
+    if (this != &rhs)
     {
         // Empty this binary search tree.
         makeEmpty();
 
         // Copy the binary search tree on the right-hand side to this binary search
-        // tree.
-        copyHelper(rhs.root);
+        // tree, node for node into a single chunk.
+        mode = rhs.mode;
+        order = rhs.order;
+        pool.reserve(sizeOf(rhs.root));
+        root = copyHelper(rhs.root, nullptr);
     }
     return *this;
 } // end of the method operator =
@@ -123,7 +318,9 @@ BinTree& BinTree::operator=(const BinTree& rhs)
 // Return: True if the two binary search trees are the same; false otherwise.
 bool BinTree::operator==(const BinTree& rhs) const
 {
-    return compareHelper(root, rhs.root);
+    // Different root hashes prove that the trees differ; equal ones still
+    // need the walk, since two different trees can share a hash.
+    return hashOf(root) == hashOf(rhs.root) && compareHelper(root, rhs.root);
 } // end of the method operator ==
 
 // ------------------------------operator != ----------------------------------
@@ -139,9 +336,36 @@ bool BinTree::operator==(const BinTree& rhs) const
 // otherwise.
 bool BinTree::operator!=(const BinTree& rhs) const
 {
-    return !compareHelper(root, rhs.root);
+    return !(*this == rhs);
 } // end of the method operator !=
 
+// ---------------------------------diff---------------------------------------
+// Description: The method diff finds the strings that are in only one of this
+// binary search tree and the given one. It descends both trees in step and
+// skips every pair of subtrees whose hashes match, so when the trees have the
+// same shape apart from d differing strings it takes O(d log n) time. Where the
+// shapes differ, it merges the two subtrees in order, which takes time linear
+// in their sizes.
+//
+// Pre: Both trees should use the same key order.
+//
+// Post: Both binary search trees do not change. Subtrees whose hashes match
+// are taken to be equal, which two different subtrees are with a chance of
+// about one in 2^64.
+//
+// Parameter: other, which is the binary search tree to compare with.
+//
+// Parameter: onlyThis, to which the node data objects of this tree that are
+// not in the given tree are added.
+//
+// Parameter: onlyOther, to which the node data objects of the given tree that
+// are not in this tree are added.
+void BinTree::diff(const BinTree& other, std::vector<const NodeData*>& onlyThis,
+                   std::vector<const NodeData*>& onlyOther) const
+{
+    diffHelper(root, other.root, onlyThis, onlyOther);
+} // end of the method diff
+
 // ---------------------------------insert-------------------------------------
 // Description: The method insert adds a tree node with the given node data
 // object, which contains a string, to this binary search tree.
@@ -151,7 +375,8 @@ bool BinTree::operator!=(const BinTree& rhs) const
 // dynamically allocated.
 //
 // Post: A tree node with the given node data object is added to this binary
-// search tree, and this binary search tree is still valid. If the same node
+// search tree, and this binary search tree is still valid. In the AVL and
+// red-black modes, this binary search tree is rebalanced. If the same node
 // data object have already been inserted into this binary search tree, this
 // method does nothing.
 //
@@ -162,57 +387,283 @@ bool BinTree::operator!=(const BinTree& rhs) const
 // object to this binary search tree; false if this method did nothing.
 bool BinTree::insert(NodeData* newData)
 {
-    // Search for a proper position to add a tree node if this binary search
-    // tree is not empty.
-    if (root != nullptr)
+    std::string_view key = newData -> getData();
+    unsigned long long summary = order.summarize(key);
+    TreeNode* parent = nullptr;
+    TreeNode** link = findLink(key, summary, parent);
+
+    // Do nothing if the same node data object is already in this tree.
+    if (link == nullptr)
+    {
+        return false;
+    }
+    TreeNode* newNode = pool.makeNode(newData);
+    newNode -> summary = summary;
+    attach(newNode, link, parent);
+    return true;
+} // end of the method insert
+
+// -----------------------------buildFromSorted--------------------------------
+// Description: The method buildFromSorted reads strings separated by white
+// space from the given stream until it ends and adds them in the same way as
+// the version for a range, holding no more than one string at a time.
+//
+// Pre: The strings should be sorted in the key order of this tree.
+//
+// Post: This binary search tree contains the strings that were read, in the
+// same way as after the version for a range.
+//
+// Parameter: input, the stream to read.
+void BinTree::buildFromSorted(std::istream& input)
+{
+    TreeNode* tail = nullptr;
+    std::vector<std::string> late;
+    std::string key;
+    while (input >> key)
+    {
+        appendHelper(key, tail, late);
+    }
+    finishHelper(tail, late);
+} // end of the method buildFromSorted
+
+// ---------------------------buildFromUnsorted--------------------------------
+// Description: The method buildFromUnsorted adds the given strings, in any
+// order, with several threads. The threads sort the strings by merge sort,
+// each sorting a part and then merging pairs of parts, the duplicates are
+// removed, and the threads build the left and right subtrees of the midpoint
+// tree at the same time, splitting again at each level until every thread
+// has a subtree of its own.
+//
+// Post: This binary search tree contains the strings, each once, and is
+// balanced in the same way as after arrayToBSTree. If this tree is not empty,
+// every string is inserted instead.
+//
+// Parameter: keys, the strings to add, which the method sorts; pass it with
+// std::move to avoid copying them.
+//
+// Parameter: threadCount, the number of threads to use; zero uses one per
+// core.
+void BinTree::buildFromUnsorted(std::vector<std::string> keys, unsigned threadCount)
+{
+    if (!isEmpty())
     {
-        TreeNode* current = root;
-        while (true)
+        for (size_t index = 0; index < keys.size(); index++)
         {
-            // Go left if the string of the given node data object is less than
-            // the string of the current node data object.
-            if (*newData < *(current -> data))
-            {
-                if (current -> left != nullptr)
-                {
-                    current = current -> left;
-                }
-                else
-                {   current -> left = new TreeNode(newData, nullptr, nullptr);
-                    // Exit the loop and the method.
-                    return true;
-                }
-            }
-            // Go right if the string of the given node data object is greater
-            // than the string of the current node data object.
-            else if (*newData > *(current -> data))
-            {
-                if (current -> right != nullptr)
-                {
-                    current = current -> right;
-                }
-                else
-                {
-                    current -> right = new TreeNode(newData, nullptr, nullptr);
-                    // Exit the loop and the method.
-                    return true;
-                }
-            }
-            // Exit the loop and the method without adding a tree node if the
-            // string of the given node data object is the same as the string
-            // of the current node data object.
-            else
-            {
-                return false;
-            }
+            insert(keys[index]);
         }
+        return;
     }
-    // Add a root node if this binary search tree is empty.
-    else
+    if (threadCount == 0)
     {
-        root = new TreeNode(newData, nullptr, nullptr);
-        return true;
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Sort, and keep the first of each run of equal strings, as insert would.
+    parallelSort(keys.data(), keys.data() + keys.size(), order, threadCount);
+    keys.erase(std::unique(keys.begin(), keys.end(),
+                           [this](const std::string& lhs, const std::string& rhs)
+                           {
+                               return order.compare(lhs, rhs) == 0;
+                           }),
+               keys.end());
+
+    int count = static_cast<int>(keys.size());
+    int redDepth = 0;
+    for (int remaining = count; remaining > 1; remaining /= 2)
+    {
+        redDepth++;
+    }
+    std::vector<const std::string*> pointers(keys.size());
+    for (size_t index = 0; index < keys.size(); index++)
+    {
+        pointers[index] = &keys[index];
+    }
+    TreeNode* nodes = pool.makeNodes(keys.size());
+    root = parallelHelper(pointers, nodes, 0, count - 1, nullptr, 0, redDepth, threadCount);
+} // end of the method buildFromUnsorted
+
+// ------------------------------------save-------------------------------------
+// Description: The method save writes the strings of this binary search tree
+// to the given stream as a binary image, in the key order and with their
+// lengths in front, in the format that the TreeFormat class describes. With
+// front coding, each string stores only the bytes that differ from the one
+// before, except at every restart point.
+//
+// Post: This binary search tree does not change.
+//
+// Parameter: output, which is the stream to write to; it should be opened in
+// binary mode.
+//
+// Parameter: frontCoding, which is whether strings share their leading bytes
+// with the string before.
+//
+// Return: True if the stream took the whole image; false otherwise.
+bool BinTree::save(std::ostream& output, bool frontCoding) const
+{
+    unsigned restartInterval = frontCoding ? TreeFormat::RESTART_INTERVAL : 1;
+    std::string image;
+    std::vector<unsigned long long> restarts;
+    TreeFormat::putHeader(image, getSize(), restartInterval);
+
+    std::string_view previous;
+    int index = 0;
+    int depth = 0;
+    for (TreeNode* node = (root == nullptr) ? nullptr : leftmost(root, depth); node != nullptr;
+         node = successor(node, depth))
+    {
+        bool restart = (index % restartInterval == 0);
+        if (restart)
+        {
+            restarts.push_back(image.size());
+        }
+        std::string_view key = node -> data -> getData();
+        TreeFormat::putRecord(image, previous, key, restart);
+        previous = key;
+        index++;
+    }
+
+    unsigned long long table = image.size();
+    for (size_t restart = 0; restart < restarts.size(); restart++)
+    {
+        TreeFormat::putFixed64(image, restarts[restart]);
+    }
+    TreeFormat::putFixed64(image, table);
+    image.append(TreeFormat::MAGIC, sizeof(TreeFormat::MAGIC));
+    output.write(image.data(), image.size());
+    return static_cast<bool>(output);
+} // end of the method save
+
+// ------------------------------------load-------------------------------------
+// Description: The method load replaces the strings of this binary search tree
+// with those in the binary image that the given stream holds. The image lists
+// the strings in order, so each is decoded straight into its tree node, and
+// the nodes are linked into a balanced tree in O(n) time.
+//
+// Pre: The image should come from a tree with the same key order.
+//
+// Post: This binary search tree holds the strings of the image and is
+// balanced in the same way as after buildFromUnsorted. If the image is not
+// valid or its strings are not in the key order of this tree, this tree is
+// empty.
+//
+// Parameter: input, which is the stream to read to its end; it should be
+// opened in binary mode.
+//
+// Return: True if the image was loaded; false otherwise.
+bool BinTree::load(std::istream& input)
+{
+    makeEmpty();
+    std::string image;
+    char buffer[1 << 16];
+    while (input.read(buffer, sizeof(buffer)) || input.gcount() > 0)
+    {
+        image.append(buffer, input.gcount());
+    }
+
+    // Every record takes at least two bytes, which bounds the count before
+    // any tree node is made.
+    const unsigned char* cursor = reinterpret_cast<const unsigned char*>(image.data());
+    const unsigned char* end = cursor + image.size();
+    unsigned long long count = 0;
+    unsigned restartInterval = 0;
+    if (!TreeFormat::getHeader(cursor, image.size(), count, restartInterval) ||
+        count > image.size() / 2 || count > INT_MAX)
+    {
+        return false;
+    }
+    cursor += TreeFormat::HEADER_SIZE;
+
+    TreeNode* nodes = pool.makeNodes(count);
+    std::string key;
+    for (unsigned long long index = 0; index < count; index++)
+    {
+        // A restart shares nothing, so an empty previous string rejects one
+        // that claims to.
+        if (index % restartInterval == 0)
+        {
+            key.clear();
+        }
+        if (!TreeFormat::getRecord(cursor, end, key))
+        {
+            makeEmpty();
+            return false;
+        }
+        TreeNode* node = nodes + index;
+        node -> data = new (node -> storage) NodeData(key);
+        node -> embedded = true;
+        node -> summary = order.summarize(key);
+        if (index > 0 && compareKey(key, node -> summary, node - 1) <= 0)
+        {
+            makeEmpty();
+            return false;
+        }
+    }
+
+    int redDepth = 0;
+    for (unsigned long long remaining = count; remaining > 1; remaining /= 2)
+    {
+        redDepth++;
+    }
+    root = linkHelper(nodes, 0, static_cast<int>(count) - 1, nullptr, 0, redDepth);
+    return true;
+} // end of the method load
+
+// -------------------------------toStaticIndex--------------------------------
+// Description: The method toStaticIndex copies the strings of this binary
+// search tree into a read-only index in Eytzinger order, whose searches walk
+// one array with no pointers and no branches on the comparisons. It takes O(n)
+// time.
+//
+// Post: This binary search tree does not change, and later changes to it do
+// not change the index.
+//
+// Return: The index, which orders its strings in the key order of this tree.
+StaticIndex BinTree::toStaticIndex() const
+{
+    std::vector<std::string_view> keys;
+    keys.reserve(getSize());
+    int depth = 0;
+    for (TreeNode* node = (root == nullptr) ? nullptr : leftmost(root, depth); node != nullptr;
+         node = successor(node, depth))
+    {
+        keys.push_back(node -> data -> getData());
+    }
+    return StaticIndex(order, keys);
+} // end of the method toStaticIndex
+
+// ---------------------------------insert-------------------------------------
+// Description: The method insert adds a tree node with a node data object
+// that contains the given string to this binary search tree. It searches
+// before it allocates, so a duplicate string costs no allocation, and the
+// node data object is stored in the new tree node itself.
+//
+// Pre: This binary search tree must be valid based on the strings that the
+// node data objects in this tree contain.
+//
+// Post: A tree node with a node data object that contains the given string
+// is added to this binary search tree, and this binary search tree is still
+// valid. In the AVL and red-black modes, this binary search tree is
+// rebalanced. If the string is already in this binary search tree, this
+// method does nothing.
+//
+// Parameter: value, the string to insert into this binary search tree.
+//
+// Return: True if this method added a tree node; false if this method did
+// nothing.
+bool BinTree::insert(const std::string& value)
+{
+    unsigned long long summary = order.summarize(value);
+    TreeNode* parent = nullptr;
+    TreeNode** link = findLink(value, summary, parent);
+
+    if (link == nullptr)
+    {
+        return false;
     }
+    TreeNode* newNode = pool.makeNode(value);
+    newNode -> summary = summary;
+    attach(newNode, link, parent);
+    return true;
 } // end of the method insert
 
 // ------------------------------operator << ----------------------------------
@@ -254,12 +705,71 @@ std::ostream& operator<<(std::ostream& output, const BinTree& binTree)
 // Return: True if this method found the given object, false otherwise.
 bool BinTree::retrieve(const NodeData& target, NodeData*& pointer) const
 {
-    return retrieveHelper(target, pointer, root);
+    return retrieve(std::string_view(target.getData()), pointer);
+} // end of the method retrieve
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method finds the node data object that contains
+// the given string in this binary search tree without creating a node data
+// object, so a lookup by a string view or a C string allocates nothing.
+//
+// Post: The given pointer will point to the node data object with the given
+// string if the string is in this tree. Otherwise, the given pointer does not
+// change.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Parameter: pointer, which will point to the node data object if the string
+// is in this tree.
+//
+// Return: True if this method found the string, false otherwise.
+bool BinTree::retrieve(std::string_view key, NodeData*& pointer) const
+{
+    TreeNode* found = retrieveHelper(key);
+    if (found == nullptr)
+    {
+        return false;
+    }
+    pointer = found -> data;
+    return true;
+} // end of the method retrieve
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method finds the node data object that contains
+// the given string, in the same way as the string view version. It and the
+// C string version exist so that such an argument does not have to choose
+// between converting to a node data object and to a string view.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Parameter: pointer, which will point to the node data object if the string
+// is in this tree.
+//
+// Return: True if this method found the string, false otherwise.
+bool BinTree::retrieve(const std::string& key, NodeData*& pointer) const
+{
+    return retrieve(std::string_view(key), pointer);
+} // end of the method retrieve
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method finds the node data object that contains
+// the given C string, in the same way as the string view version.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Parameter: pointer, which will point to the node data object if the string
+// is in this tree.
+//
+// Return: True if this method found the string, false otherwise.
+bool BinTree::retrieve(const char* key, NodeData*& pointer) const
+{
+    return retrieve(std::string_view(key), pointer);
 } // end of the method retrieve
 
 // -------------------------------getHeight------------------------------------
 // Description: The method getHeight reports the height of the tree node that
-// contains the given node data object.
+// contains the given node data object. It descends to the node and reads the
+// height that the node caches, so it takes O(h) time for a tree of height h.
 //
 // Pre: The given node data object should be in this binary search tree.
 //
@@ -272,430 +782,2368 @@ bool BinTree::retrieve(const NodeData& target, NodeData*& pointer) const
 // does not exist in this binary search tree.
 int BinTree::getHeight(const NodeData& target) const
 {
-    return heightHelper(target, root, 0);
+    TreeNode* found = retrieveHelper(target.getData());
+    return (found == nullptr) ? 0 : found -> height;
 } // end of the method getHeight
 
-// ----------------------------displaySideways---------------------------------
-// Description: The method displaySideways displays this binary search tree as
-// though you are viewing it from the side.
+// ---------------------------------rank---------------------------------------
+// Description: The method rank counts the node data objects in this binary
+// search tree that come before the given one in its key order. It descends
+// once and adds up the subtree sizes that the tree nodes cache, so it takes
+// O(h) time for a tree of height h.
 //
 // Post: This binary search tree does not change.
-void BinTree::displaySideways() const
-{
-    sidewaysHelper(root, 0);
-} // end of the method displaySideways
-
-// -----------------------------bstreeToArray----------------------------------
-// Description: The method bstreeToArray adds the node data objects in this
-// binary search tree to the given array based on inorder traversal.
 //
-// Pre: The given array should be a statically allocated array which has 100
-// null pointers. The number of tree nodes in this binary search tree cannot be
-// greater than 100.
-//
-// Post: The given array contains the node data objects in this binary search
-// tree, and the node data objects are sorted in an increasing order based on
-// the strings they contain. This binary search tree is empty.
+// Parameter: target, which is the node data object to rank; it does not
+// have to be in this tree.
 //
-// Parameter: dataArray, which is the array where the node data objects should
-// be contained.
-void BinTree::bstreeToArray(NodeData* dataArray[])
+// Return: The number of node data objects less than the given one, which
+// is also its position, counting from zero, if it is in this tree.
+int BinTree::rank(const NodeData& target) const
 {
-    int index = 0;
-    toArrayHelper(dataArray, index, root);
-} // end of the method bstreeToArray
+    return rankHelper(target.getData(), false);
+} // end of the method rank
 
-// -----------------------------arrayToBSTree----------------------------------
-// Description: The method arrayToBSTree creates a balanced binary search tree
-// from a sorted array that contains node data objects.
+// --------------------------------select--------------------------------------
+// Description: The method select finds the node data object at the given
+// position in the key order of this binary search tree, so select(0) finds
+// the smallest one. It takes O(h) time for a tree of height h.
 //
-// Pre: The given array should be of size 100 and be sorted in an increasing
-// order based on the strings that the node data objects contain. This binary
-// search tree should be empty. Finally, there should not be null pointers
-// between the node data objects in the given array.
+// Post: The given pointer will point to the node data object at the given
+// position if the position is less than the size of this tree. Otherwise,
+// the given pointer does not change.
 //
-// Post: The node data objects in the given array are replaced with null
-// pointers. This binary search tree is a balanced tree which contains the node
-// data objects that the given array contained. If the given array is not
-// sorted or this binary search tree is not empty when this method is invoked,
-// this method does nothing. If there are null pointers between the node data
-// objects in the given array, this method considers the node data objects
-// before the first null pointer.
+// Parameter: position, which is the number of node data objects before the
+// one to find.
 //
-// Parameter: dataArray, which is the array that contains node data objects.
-void BinTree::arrayToBSTree(NodeData* dataArray[])
+// Parameter: pointer, which will point to the node data object found.
+//
+// Return: True if this method found a node data object, false otherwise.
+bool BinTree::select(int position, NodeData*& pointer) const
 {
-    // Use the array to build this binary search tree if this binary search
-    // tree is empty.
-    if (isEmpty())
+    if (position < 0 || position >= sizeOf(root))
     {
-        // Check whether the given array is sorted.
-        bool sorted = true;
-        int index = 0;
-        NodeData* previous = dataArray[index];
-        index++;
-        while (sorted && index < 100 && dataArray[index] != nullptr)
+        return false;
+    }
+
+    // The left subtree holds the positions before the current node; going
+    // right skips them and the current node.
+    TreeNode* current = root;
+    while (position != sizeOf(current -> left))
+    {
+        if (position < sizeOf(current -> left))
         {
-            sorted = (*previous < *dataArray[index]);
-            previous = dataArray[index];
-            index++;
+            current = current -> left;
         }
-
-        // Use the sorted array to build this binary search tree.
-        if (sorted)
+        else
         {
-            toTreeHelper(dataArray, 0, --index, root);
+            position -= sizeOf(current -> left) + 1;
+            current = current -> right;
         }
     }
-} // end of the method arrayToBSTree
+    pointer = current -> data;
+    return true;
+} // end of the method select
 
-// -------------------------------emptyHelper----------------------------------
-// Description: The method emptyHelper deletes the binary tree whose root node
-// is the given tree node, freeing the memory that is dynamically allocated to
-// the binary tree.
+// ------------------------------countRange------------------------------------
+// Description: The method countRange counts the node data objects in this
+// binary search tree from the given low one to the given high one,
+// inclusive, with two descents. It takes O(h) time for a tree of height h.
+//
+// Post: This binary search tree does not change.
 //
-// Pre: The given tree node must be a node of this binary search tree (where
-// this method is initially invoked) or a null pointer.
+// Parameter: low, which is the smallest node data object to count.
 //
-// Post: The binary tree whose root node is the given tree node is empty. The
-// dynamically allocated memory is free.
+// Parameter: high, which is the largest node data object to count.
 //
-// Parameter: rootEmpty, which is the root node of the binary tree to delete
-// within this recursive call.
-void BinTree::emptyHelper(TreeNode*& rootEmpty)
+// Return: The number of node data objects in the range; zero if the high
+// one comes before the low one.
+int BinTree::countRange(const NodeData& low, const NodeData& high) const
 {
-    // Empty the binary tree whose root node is the given node if the given
-    // node is not a null pointer.
-    if (rootEmpty != nullptr)
-    {
-        // Delete the left and right subtrees of the given node and set the
-        // left and right pointers of the given node to null pointers.
-        emptyHelper(rootEmpty -> left);
-        emptyHelper(rootEmpty -> right);
+    int count = rankHelper(high.getData(), true) - rankHelper(low.getData(), false);
+    return (count > 0) ? count : 0;
+} // end of the method countRange
 
-        // Delete the given node and set it to null pointer.
-        delete rootEmpty;
-        rootEmpty = nullptr;
-    }
-} // end of the method emptyHelper
+// ---------------------------------begin--------------------------------------
+// Description: The method begin returns an iterator at the smallest node
+// data object in this binary search tree.
+//
+// Return: The iterator; the end iterator if this tree is empty.
+BinTree::Iterator BinTree::begin() const
+{
+    int depth = 0;
+    return Iterator(this, (root == nullptr) ? nullptr : leftmost(root, depth));
+} // end of the method begin
 
-// -------------------------------copyHelper---------------------------------
-// Description: The method copyHelper copies another binary search tree to
-// this binary search tree by using preorder traversal to add the nodes in
-// another binary search tree, whose root node is the given tree node, to
-// this binary search tree.
+// ----------------------------------end---------------------------------------
+// Description: The method end returns the iterator just after the largest
+// node data object in this binary search tree.
 //
-// Pre: The given tree node must be a node of the binary search tree to copy.
-// Before this method is initially invoked, this binary search tree (where
-// this method is initially invoked) must be empty.
+// Return: The end iterator.
+BinTree::Iterator BinTree::end() const
+{
+    return Iterator(this, nullptr);
+} // end of the method end
+
+// ------------------------------lowerBound------------------------------------
+// Description: The method lowerBound finds the first node data object in
+// this binary search tree that does not come before the given one. It
+// descends once, so it takes O(h) time for a tree of height h.
 //
-// Post: The nodes in the binary search tree whose root node is the given tree
-// node is added to this binary search tree based on preorder traversal.
+// Parameter: target, which is the node data object to search for; it does
+// not have to be in this tree.
 //
-// Parameter: rootCopy, which is the root node of the binary search tree to
-// copy within this recursive call.
-void BinTree::copyHelper(TreeNode* rootCopy)
+// Return: An iterator at the node data object found; the end iterator if
+// every object comes before the given one.
+BinTree::Iterator BinTree::lowerBound(const NodeData& target) const
 {
-    // Copy the binary search tree whose root node is the given node if the
-    // given node is not a null pointer.
-    if (rootCopy != nullptr)
-    {
-        NodeData* newData = new NodeData(*(rootCopy -> data));
-        insert(newData);
-
-        // Copy the left and right subtrees of the given node.
-        copyHelper(rootCopy -> left);
-        copyHelper(rootCopy -> right);
-    }
-} // end of the method copyHelper
+    return Iterator(this, boundHelper(target.getData(), false));
+} // end of the method lowerBound
 
-// ------------------------------compareHelper---------------------------------
-// Description: The method compareHelper checks whether the two binary trees,
-// whose root nodes are the given nodes, have the same data items and the same
-// structure.
+// ------------------------------upperBound------------------------------------
+// Description: The method upperBound finds the first node data object in
+// this binary search tree that comes after the given one, in the same way
+// as lowerBound.
 //
-// Pre: One given node must be a node of this binary search tree (where this
-// method is initially invoked); the other given node must be a node of a
-// different binary tree.
+// Parameter: target, which is the node data object to search for.
 //
-// Post: Both binary trees do not change.
+// Return: An iterator at the node data object found; the end iterator if
+// no object comes after the given one.
+BinTree::Iterator BinTree::upperBound(const NodeData& target) const
+{
+    return Iterator(this, boundHelper(target.getData(), true));
+} // end of the method upperBound
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an iterator that does not
+// belong to any tree.
+BinTree::Iterator::Iterator() : tree(nullptr), node(nullptr)
+{
+
+} // end of the default constructor
+
+// ------------------------Parametrized Constructor----------------------------
+// Description: The parametrized constructor creates an iterator at the given
+// tree node of the given tree.
 //
-// Parameter: rootThis, which is a node of this binary search tree and is the
-// root node of a binary tree to check within this recursive call.
+// Parameter: tree, the tree to iterate over.
 //
-// Parameter: rootOther, which is a node of a different binary tree and is
-// the root node of another binary tree to check within this recursive call.
+// Parameter: node, the tree node to start at; a null pointer for the end.
+BinTree::Iterator::Iterator(const BinTree* tree, TreeNode* node) : tree(tree), node(node)
+{
+
+} // end of the parametrized constructor
+
+// -------------------------------operator *-----------------------------------
+// Description: The operator * returns the node data object that this
+// iterator is at.
 //
-// Return: True if the two binary trees are the same; false otherwise.
-bool BinTree::compareHelper(TreeNode* rootThis, TreeNode* rootOther) const
+// Pre: This iterator must not be at the end of its tree.
+//
+// Return: A reference to the node data object.
+const NodeData& BinTree::Iterator::operator*() const
+{
+    return *(node -> data);
+} // end of the method operator *
+
+// -------------------------------operator ->----------------------------------
+// Description: The operator -> returns the node data object that this
+// iterator is at.
+//
+// Pre: This iterator must not be at the end of its tree.
+//
+// Return: A pointer to the node data object.
+const NodeData* BinTree::Iterator::operator->() const
+{
+    return node -> data;
+} // end of the method operator ->
+
+// -------------------------------operator ++----------------------------------
+// Description: The operator ++ moves this iterator to the next node data
+// object, or to the end after the last one. It takes O(1) amortized time.
+//
+// Return: A reference to this iterator.
+BinTree::Iterator& BinTree::Iterator::operator++()
+{
+    // The iterator does not track depths, so the depth is a scratch value.
+    int depth = 0;
+    node = successor(node, depth);
+    return *this;
+} // end of the method operator ++
+
+// -------------------------------operator ++----------------------------------
+// Description: The postfix operator ++ moves this iterator forward.
+//
+// Return: A copy of this iterator from before it moved.
+BinTree::Iterator BinTree::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+} // end of the method operator ++
+
+// -------------------------------operator -- ---------------------------------
+// Description: The operator -- moves this iterator to the previous node
+// data object, or from the end to the last one.
+//
+// Return: A reference to this iterator.
+BinTree::Iterator& BinTree::Iterator::operator--()
+{
+    int depth = 0;
+    if (node == nullptr)
+    {
+        node = (tree -> root == nullptr) ? nullptr : rightmost(tree -> root, depth);
+    }
+    else
+    {
+        node = predecessor(node, depth);
+    }
+    return *this;
+} // end of the method operator --
+
+// -------------------------------operator -- ---------------------------------
+// Description: The postfix operator -- moves this iterator backward.
+//
+// Return: A copy of this iterator from before it moved.
+BinTree::Iterator BinTree::Iterator::operator--(int)
+{
+    Iterator previous = *this;
+    --(*this);
+    return previous;
+} // end of the method operator --
+
+// -------------------------------operator ==----------------------------------
+// Description: The operator == reports whether two iterators are at the
+// same place.
+//
+// Parameter: rhs, the iterator to compare with.
+//
+// Return: True if both are at the same tree node or both at the end.
+bool BinTree::Iterator::operator==(const Iterator& rhs) const
+{
+    return node == rhs.node;
+} // end of the method operator ==
+
+// -------------------------------operator !=----------------------------------
+// Description: The operator != reports whether two iterators are at
+// different places.
+//
+// Parameter: rhs, the iterator to compare with.
+//
+// Return: True if they are at different places.
+bool BinTree::Iterator::operator!=(const Iterator& rhs) const
+{
+    return node != rhs.node;
+} // end of the method operator !=
+
+// ----------------------------displaySideways---------------------------------
+// Description: The method displaySideways displays this binary search tree as
+// though you are viewing it from the side.
+//
+// Post: This binary search tree does not change.
+void BinTree::displaySideways() const
+{
+    sidewaysHelper(root);
+} // end of the method displaySideways
+
+// -----------------------------bstreeToArray----------------------------------
+// Description: The method bstreeToArray adds the node data objects in this
+// binary search tree to the given array based on inorder traversal.
+//
+// Pre: The given array should have a null pointer for every tree node in this
+// binary search tree, from the first position on.
+//
+// Post: The given array contains the node data objects in this binary search
+// tree, and the node data objects are sorted in the key order of this tree,
+// which by default is the order of their strings. A node data object that was
+// stored in a tree node is copied to a dynamically allocated one. This binary
+// search tree is empty.
+//
+// Parameter: dataArray, which is the array where the node data objects should
+// be contained.
+void BinTree::bstreeToArray(NodeData* dataArray[])
+{
+    int index = 0;
+    toArrayHelper(dataArray, index, root);
+} // end of the method bstreeToArray
+
+// -----------------------------arrayToBSTree----------------------------------
+// Description: The method arrayToBSTree creates a balanced binary search tree
+// from a sorted array that contains node data objects.
+//
+// Pre: The given array should be of size 100 and be sorted in the key order of
+// this tree, which by default is the order of the strings that the node data
+// objects contain. This binary search tree should be empty. Finally, there
+// should not be null pointers between the node data objects in the given array.
+//
+// Post: The node data objects in the given array are replaced with null
+// pointers. This binary search tree is a balanced tree which contains the node
+// data objects that the given array contained. The tree is also a valid AVL
+// tree and, with the nodes on its deepest level colored red, a valid red-black
+// tree. If the given array is not sorted or this binary search tree is not
+// empty when this method is invoked, this method does nothing. If there are
+// null pointers between the node data objects in the given array, this method
+// considers the node data objects before the first null pointer.
+//
+// Parameter: dataArray, which is the array that contains node data objects.
+void BinTree::arrayToBSTree(NodeData* dataArray[])
+{
+    int count = 0;
+    while (count < 100 && dataArray[count] != nullptr)
+    {
+        count++;
+    }
+    arrayToBSTree(dataArray, count);
+} // end of the method arrayToBSTree
+
+// -----------------------------bstreeToArray----------------------------------
+// Description: The method bstreeToArray moves the node data objects in this
+// binary search tree to the given vector based on inorder traversal. The
+// vector grows to fit, so the tree can have any number of nodes.
+//
+// Post: The given vector contains only the node data objects in this binary
+// search tree, sorted in the key order of this tree. A node data object that
+// was stored in a tree node is copied to a dynamically allocated one. This
+// binary search tree is empty.
+//
+// Parameter: dataArray, which is the vector where the node data objects
+// should be contained.
+void BinTree::bstreeToArray(std::vector<NodeData*>& dataArray)
+{
+    // Every tree node counts its subtree, so the vector is sized once.
+    dataArray.assign(sizeOf(root), nullptr);
+    int index = 0;
+    toArrayHelper(dataArray.data(), index, root);
+} // end of the method bstreeToArray
+
+// -----------------------------arrayToBSTree----------------------------------
+// Description: The method arrayToBSTree creates a balanced binary search tree
+// from the first count node data objects in the given array. It checks the
+// order and builds the tree in one pass each, so it takes O(n) time.
+//
+// Pre: The first count entries of the given array should be dynamically
+// allocated node data objects sorted in the key order of this tree. This
+// binary search tree should be empty.
+//
+// Post: The first count entries of the given array are replaced with null
+// pointers, and this binary search tree is balanced in the same way as the
+// version for an array of size 100. If the entries are not sorted or this
+// binary search tree is not empty, this method does nothing.
+//
+// Parameter: dataArray, which is the array that contains node data objects.
+//
+// Parameter: count, which is the number of node data objects to use.
+void BinTree::arrayToBSTree(NodeData* dataArray[], int count)
+{
+    buildHelper(dataArray, count);
+} // end of the method arrayToBSTree
+
+// -----------------------------arrayToBSTree----------------------------------
+// Description: The method arrayToBSTree creates a balanced binary search tree
+// from every node data object in the given vector, in the same way as the
+// version that takes a count.
+//
+// Post: If this binary search tree was built, the given vector is empty.
+// Otherwise neither this tree nor the vector changes.
+//
+// Parameter: dataArray, which is the vector that contains node data objects.
+void BinTree::arrayToBSTree(std::vector<NodeData*>& dataArray)
+{
+    if (buildHelper(dataArray.data(), static_cast<int>(dataArray.size())))
+    {
+        dataArray.clear();
+    }
+} // end of the method arrayToBSTree
+
+// -------------------------------rebalance------------------------------------
+// Description: The method rebalance reshapes this binary search tree into a
+// balanced one in place with the Day-Stout-Warren algorithm: it rotates the
+// tree into a vine, a chain of right children, and then compresses the vine
+// with rounds of left rotations. It takes O(n) time and needs no array.
+//
+// Post: This binary search tree contains the same node data objects and has
+// the smallest possible height, with every level full except the deepest.
+// The tree is a valid AVL tree and, with the nodes on its deepest level
+// colored red, a valid red-black tree.
+void BinTree::rebalance()
+{
+    if (root == nullptr)
+    {
+        return;
+    }
+    int count = makeVine();
+
+    // The first round places the nodes that do not fit in a perfect tree of
+    // size 2^k - 1 on the deepest level; each later round halves the spine.
+    int perfect = 1;
+    while (perfect <= count + 1)
+    {
+        perfect *= 2;
+    }
+    perfect = perfect / 2 - 1;
+    compress(count - perfect);
+    for (int size = perfect / 2; size > 0; size /= 2)
+    {
+        compress(size);
+    }
+
+    int redDepth = 0;
+    for (int remaining = count; remaining > 1; remaining /= 2)
+    {
+        redDepth++;
+    }
+    refreshHelper(redDepth);
+} // end of the method rebalance
+
+// ------------------------------------unite------------------------------------
+// Description: The method unite makes this binary search tree the union of
+// itself and the given tree.
+//
+// Pre: Both trees should use the same key order.
+//
+// Post: This binary search tree contains every string that was in either
+// tree, balanced in the same way as after buildFromUnsorted. The given tree
+// does not change.
+//
+// Parameter: other, which is the binary search tree to combine with.
+//
+// Parameter: threadCount, the number of threads to use; zero uses one per
+// core.
+void BinTree::unite(const BinTree& other, unsigned threadCount)
+{
+    if (&other != this)
+    {
+        combine(other, ONLY_THIS | ONLY_OTHER | IN_BOTH, threadCount);
+    }
+} // end of the method unite
+
+// ----------------------------------intersect----------------------------------
+// Description: The method intersect keeps only the strings of this binary
+// search tree that are also in the given tree.
+//
+// Pre: Both trees should use the same key order.
+//
+// Post: This binary search tree contains the strings that were in both
+// trees, balanced in the same way as after buildFromUnsorted. The given tree
+// does not change.
+//
+// Parameter: other, which is the binary search tree to combine with.
+//
+// Parameter: threadCount, the number of threads to use; zero uses one per
+// core.
+void BinTree::intersect(const BinTree& other, unsigned threadCount)
+{
+    if (&other != this)
+    {
+        combine(other, IN_BOTH, threadCount);
+    }
+} // end of the method intersect
+
+// ----------------------------------subtract-----------------------------------
+// Description: The method subtract removes the strings that are in the given
+// tree from this binary search tree.
+//
+// Pre: Both trees should use the same key order.
+//
+// Post: This binary search tree contains the strings that were in it but
+// not in the given tree, balanced in the same way as after buildFromUnsorted.
+// The given tree does not change.
+//
+// Parameter: other, which is the binary search tree to combine with.
+//
+// Parameter: threadCount, the number of threads to use; zero uses one per
+// core.
+void BinTree::subtract(const BinTree& other, unsigned threadCount)
+{
+    if (&other == this)
+    {
+        makeEmpty();
+        return;
+    }
+    combine(other, ONLY_THIS, threadCount);
+} // end of the method subtract
+
+// ------------------------------------split------------------------------------
+// Description: The method split moves the tree nodes whose strings come at or
+// after the given string into the given tree, and keeps the rest. It cuts
+// the search path for the string into subtrees and joins them back into two
+// trees, so it takes O(log n) time in the AVL and red-black modes; no node
+// data object is copied or allocated.
+//
+// Pre: The given tree is not this tree.
+//
+// Post: This binary search tree contains the strings before the given one,
+// and the given tree, which takes the balance mode and key order of this
+// tree, contains the others. What the given tree held before is gone. The two
+// trees share the chunks that held the tree nodes until both release them,
+// but each allocates new tree nodes on its own, so they can be used by
+// different threads.
+//
+// Parameter: key, which is the first string to move.
+//
+// Parameter: upper, which receives the strings from the given one on.
+void BinTree::split(const NodeData& key, BinTree& upper)
+{
+    upper.makeEmpty();
+    upper.mode = mode;
+    upper.order = order;
+    if (root == nullptr)
+    {
+        return;
+    }
+    pool.share(upper.pool);
+
+    // Follow the search path, noting for each node whether it goes to the
+    // lower or the upper tree and the black height of the subtree below it
+    // that goes along. The node with the given string, if any, ends the path,
+    // and its left subtree starts the lower tree.
+    std::string_view target = key.getData();
+    unsigned long long summary = order.summarize(target);
+    std::vector<TreeNode*> path;
+    std::vector<int> pathBlack;
+    TreeNode* lowerRoot = nullptr;
+    int lowerBlack = 0;
+    int blackHeight = (mode == RED_BLACK) ? blackHeightOf(root) : 0;
+    TreeNode* node = root;
+    while (node != nullptr)
+    {
+        int childBlack = (mode == RED_BLACK && !node -> red) ? blackHeight - 1 : blackHeight;
+        int comparison = compareKey(target, summary, node);
+        path.push_back(node);
+        pathBlack.push_back(childBlack);
+        if (comparison == 0)
+        {
+            lowerRoot = node -> left;
+            lowerBlack = childBlack;
+            break;
+        }
+        node = (comparison < 0) ? node -> left : node -> right;
+        blackHeight = childBlack;
+    }
+
+    // Join the pieces from the bottom up: a node that comes after the string
+    // joins the upper tree built so far with its right subtree, and one that
+    // comes before joins its left subtree with the lower tree.
+    TreeNode* upperRoot = nullptr;
+    int upperBlack = 0;
+    for (size_t index = path.size(); index-- > 0;)
+    {
+        node = path[index];
+        TreeNode* left = node -> left;
+        TreeNode* right = node -> right;
+        if (compareKey(target, summary, node) <= 0)
+        {
+            upperBlack = joinHelper(upperRoot, node, right, upperBlack, pathBlack[index]);
+            upperRoot = root;
+        }
+        else
+        {
+            lowerBlack = joinHelper(left, node, lowerRoot, pathBlack[index], lowerBlack);
+            lowerRoot = root;
+        }
+    }
+    // A piece that was never joined still points to its old parent, and in
+    // the red-black mode its root may be red.
+    root = lowerRoot;
+    upper.root = upperRoot;
+    if (root != nullptr)
+    {
+        root -> parent = nullptr;
+        root -> red = false;
+    }
+    if (upper.root != nullptr)
+    {
+        upper.root -> parent = nullptr;
+        upper.root -> red = false;
+    }
+} // end of the method split
+
+// ------------------------------------join-------------------------------------
+// Description: The method join moves every tree node of the given tree into
+// this binary search tree, whose strings must all come before those of the
+// given tree. It takes the first tree node of the given tree out along its
+// left path and hangs the two trees from it, so it takes O(log n) time in
+// the AVL and red-black modes and copies no node data object.
+//
+// Post: If this tree and the given tree have the same balance mode and key
+// order and every string of this tree comes before every string of the given
+// tree, this tree contains the strings of both, the given tree is empty, and
+// this tree takes over its chunks. Otherwise neither tree changes.
+//
+// Parameter: upper, which is the tree whose strings come after those of this
+// tree.
+//
+// Return: True if the trees were joined; false otherwise.
+bool BinTree::join(BinTree& upper)
+{
+    if (&upper == this || upper.mode != mode || upper.order.summarize != order.summarize ||
+        upper.order.compare != order.compare)
+    {
+        return false;
+    }
+    if (upper.root == nullptr)
+    {
+        return true;
+    }
+
+    int depth = 0;
+    TreeNode* first = leftmost(upper.root, depth);
+    if (root != nullptr)
+    {
+        TreeNode* last = rightmost(root, depth);
+        if (compareKey(last -> data -> getData(), last -> summary, first) >= 0)
+        {
+            return false;
+        }
+    }
+    pool.adopt(upper.pool);
+
+    // Take the first node of the given tree out: join the subtrees along its
+    // left path from the bottom up, starting with the right subtree of the
+    // first node.
+    std::vector<TreeNode*> path;
+    std::vector<int> pathBlack;
+    int blackHeight = (mode == RED_BLACK) ? blackHeightOf(upper.root) : 0;
+    for (TreeNode* node = upper.root; node != first; node = node -> left)
+    {
+        path.push_back(node);
+        blackHeight = (mode == RED_BLACK && !node -> red) ? blackHeight - 1 : blackHeight;
+        pathBlack.push_back(blackHeight);
+    }
+    int restBlack = (mode == RED_BLACK && !first -> red) ? blackHeight - 1 : blackHeight;
+    TreeNode* rest = first -> right;
+    TreeNode* lower = root;
+    for (size_t index = path.size(); index-- > 0;)
+    {
+        restBlack = joinHelper(rest, path[index], path[index] -> right, restBlack,
+                               pathBlack[index]);
+        rest = root;
+    }
+
+    int lowerBlack = (mode == RED_BLACK) ? blackHeightOf(lower) : 0;
+    joinHelper(lower, first, rest, lowerBlack, restBlack);
+    if (mode == RED_BLACK)
+    {
+        root -> red = false;
+    }
+    upper.root = nullptr;
+    return true;
+} // end of the method join
+
+// -------------------------------leftmost-------------------------------------
+// Description: The method leftmost returns the first tree node in inorder
+// of the subtree whose root node is the given node.
+//
+// Pre: The given node must not be a null pointer.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Parameter: depth, which is the depth of the given node and becomes the
+// depth of the returned node.
+//
+// Return: The leftmost tree node of the subtree.
+TreeNode* BinTree::leftmost(TreeNode* node, int& depth)
+{
+    while (node -> left != nullptr)
+    {
+        node = node -> left;
+        depth++;
+    }
+    return node;
+} // end of the method leftmost
+
+// -------------------------------rightmost------------------------------------
+// Description: The method rightmost returns the last tree node in inorder
+// of the subtree whose root node is the given node.
+//
+// Pre: The given node must not be a null pointer.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Parameter: depth, which is the depth of the given node and becomes the
+// depth of the returned node.
+//
+// Return: The rightmost tree node of the subtree.
+TreeNode* BinTree::rightmost(TreeNode* node, int& depth)
+{
+    while (node -> right != nullptr)
+    {
+        node = node -> right;
+        depth++;
+    }
+    return node;
+} // end of the method rightmost
+
+// -------------------------------successor------------------------------------
+// Description: The method successor returns the tree node that follows the
+// given node in inorder. It steps down to the leftmost node of the right
+// subtree or climbs the parent pointers, so a whole traversal visits every
+// edge twice and needs no stack.
+//
+// Pre: The given node must not be a null pointer.
+//
+// Parameter: node, which is the current tree node.
+//
+// Parameter: depth, which is the depth of the given node and becomes the
+// depth of the returned node.
+//
+// Return: The next tree node in inorder; a null pointer after the last.
+TreeNode* BinTree::successor(TreeNode* node, int& depth)
+{
+    if (node -> right != nullptr)
+    {
+        depth++;
+        return leftmost(node -> right, depth);
+    }
+
+    // Climb while coming back from a right child; the first ancestor reached
+    // from its left child is next.
+    while (node -> parent != nullptr && node == node -> parent -> right)
+    {
+        node = node -> parent;
+        depth--;
+    }
+    depth--;
+    return node -> parent;
+} // end of the method successor
+
+// ------------------------------predecessor-----------------------------------
+// Description: The method predecessor returns the tree node that comes
+// before the given node in inorder, in the same way as successor.
+//
+// Pre: The given node must not be a null pointer.
+//
+// Parameter: node, which is the current tree node.
+//
+// Parameter: depth, which is the depth of the given node and becomes the
+// depth of the returned node.
+//
+// Return: The previous tree node in inorder; a null pointer before the
+// first.
+TreeNode* BinTree::predecessor(TreeNode* node, int& depth)
+{
+    if (node -> left != nullptr)
+    {
+        depth++;
+        return rightmost(node -> left, depth);
+    }
+
+    while (node -> parent != nullptr && node == node -> parent -> left)
+    {
+        node = node -> parent;
+        depth--;
+    }
+    depth--;
+    return node -> parent;
+} // end of the method predecessor
+
+// ------------------------------nextPreorder----------------------------------
+// Description: The method nextPreorder returns the tree node that follows
+// the given node in preorder within the subtree whose root node is the
+// given top node.
+//
+// Pre: The given node must be in the subtree of the given top node.
+//
+// Parameter: node, which is the current tree node.
+//
+// Parameter: top, which is the root node of the subtree to traverse.
+//
+// Parameter: depth, which is the depth of the given node and becomes the
+// depth of the returned node.
+//
+// Return: The next tree node in preorder; a null pointer after the last
+// node of the subtree.
+TreeNode* BinTree::nextPreorder(TreeNode* node, const TreeNode* top, int& depth)
+{
+    if (node -> left != nullptr)
+    {
+        depth++;
+        return node -> left;
+    }
+    if (node -> right != nullptr)
+    {
+        depth++;
+        return node -> right;
+    }
+
+    // Climb until an ancestor has a right subtree that has not been visited,
+    // which is the case when we come back from its left child.
+    while (node != top)
+    {
+        TreeNode* parent = node -> parent;
+        if (node == parent -> left && parent -> right != nullptr)
+        {
+            return parent -> right;
+        }
+        node = parent;
+        depth--;
+    }
+    return nullptr;
+} // end of the method nextPreorder
+
+// -------------------------------copyHelper---------------------------------
+// Description: The method copyHelper copies the binary tree whose root node
+// is the given tree node node by node, keeping its structure, heights and
+// colors. It walks the tree to copy and the copy in step: it goes down to a
+// child that has not been copied yet and otherwise climbs back through the
+// parent pointers of both trees. It makes no comparisons, so the copy takes
+// O(n) time whatever the shape of the tree.
+//
+// Pre: The given tree node must be a node of the binary search tree to copy
+// or a null pointer.
+//
+// Post: The binary tree whose root node is the given tree node does not
+// change.
+//
+// Parameter: rootCopy, which is the root node of the binary tree to copy.
+//
+// Parameter: parentCopy, which is the tree node that the copy should hang
+// from.
+//
+// Return: The root node of the copy; a null pointer if the given node is a
+// null pointer.
+TreeNode* BinTree::copyHelper(const TreeNode* rootCopy, TreeNode* parentCopy)
+{
+    if (rootCopy == nullptr)
+    {
+        return nullptr;
+    }
+
+    TreeNode* newRoot = pool.makeNode(*(rootCopy -> data));
+    newRoot -> parent = parentCopy;
+    newRoot -> summary = rootCopy -> summary;
+    newRoot -> height = rootCopy -> height;
+    newRoot -> size = rootCopy -> size;
+    newRoot -> hash = rootCopy -> hash;
+    newRoot -> red = rootCopy -> red;
+
+    const TreeNode* source = rootCopy;
+    TreeNode* copy = newRoot;
+    while (true)
+    {
+        const TreeNode* next = nullptr;
+        if (source -> left != nullptr && copy -> left == nullptr)
+        {
+            next = source -> left;
+            copy -> left = pool.makeNode(*(next -> data));
+            copy -> left -> parent = copy;
+            copy = copy -> left;
+        }
+        else if (source -> right != nullptr && copy -> right == nullptr)
+        {
+            next = source -> right;
+            copy -> right = pool.makeNode(*(next -> data));
+            copy -> right -> parent = copy;
+            copy = copy -> right;
+        }
+
+        if (next != nullptr)
+        {
+            copy -> summary = next -> summary;
+            copy -> height = next -> height;
+            copy -> size = next -> size;
+            copy -> hash = next -> hash;
+            copy -> red = next -> red;
+            source = next;
+        }
+        // Both children are copied, so go back up in both trees.
+        else if (source != rootCopy)
+        {
+            source = source -> parent;
+            copy = copy -> parent;
+        }
+        else
+        {
+            return newRoot;
+        }
+    }
+} // end of the method copyHelper
+
+// ------------------------------compareHelper---------------------------------
+// Description: The method compareHelper checks whether the two binary trees,
+// whose root nodes are the given nodes, have the same data items and the same
+// structure. It walks both trees in preorder in step and stops at the first
+// node whose data item or children differ.
+//
+// Pre: One given node must be a node of this binary search tree (where this
+// method is initially invoked); the other given node must be a node of a
+// different binary tree.
+//
+// Post: Both binary trees do not change.
+//
+// Parameter: rootThis, which is a node of this binary search tree and is the
+// root node of a binary tree to check.
+//
+// Parameter: rootOther, which is a node of a different binary tree and is
+// the root node of another binary tree to check.
+//
+// Return: True if the two binary trees are the same; false otherwise.
+bool BinTree::compareHelper(TreeNode* rootThis, TreeNode* rootOther) const
 {
     // Return true if both given nodes are null pointers.
     if (rootThis == nullptr && rootOther == nullptr)
     {
-        return true;
+        return true;
+    }
+    // Return false if only one given node is a null pointer.
+    else if (rootThis == nullptr || rootOther == nullptr)
+    {
+        return false;
+    }
+
+    // So far both trees have the same shape, so the two walks stay in step.
+    TreeNode* nodeThis = rootThis;
+    TreeNode* nodeOther = rootOther;
+    int depthThis = 0;
+    int depthOther = 0;
+    while (nodeThis != nullptr)
+    {
+        if (*(nodeThis -> data) != *(nodeOther -> data) ||
+            (nodeThis -> left == nullptr) != (nodeOther -> left == nullptr) ||
+            (nodeThis -> right == nullptr) != (nodeOther -> right == nullptr))
+        {
+            return false;
+        }
+        nodeThis = nextPreorder(nodeThis, rootThis, depthThis);
+        nodeOther = nextPreorder(nodeOther, rootOther, depthOther);
+    }
+    return true;
+} // end of the method compareHelper
+
+// ------------------------------diffHelper------------------------------------
+// Description: The method diffHelper adds the strings that are in only one
+// of the two given subtrees, which hold the strings of the same key range, to
+// the given lists.
+//
+// Parameter: nodeThis, which is the root node of the subtree of this tree.
+//
+// Parameter: nodeOther, which is the root node of the subtree of the other
+// tree.
+//
+// Parameter: onlyThis, which collects the strings only in this tree.
+//
+// Parameter: onlyOther, which collects the strings only in the other tree.
+void BinTree::diffHelper(TreeNode* nodeThis, TreeNode* nodeOther,
+                         std::vector<const NodeData*>& onlyThis,
+                         std::vector<const NodeData*>& onlyOther) const
+{
+    // Matching hashes end the descent; matching strings split both subtrees
+    // at the same key, so the halves can be compared separately. The pairs
+    // wait on a stack of their own rather than the call stack, with the left
+    // pair on top, so the strings are still found in order.
+    std::vector<std::pair<TreeNode*, TreeNode*>> pending;
+    pending.push_back(std::make_pair(nodeThis, nodeOther));
+    while (!pending.empty())
+    {
+        TreeNode* currentThis = pending.back().first;
+        TreeNode* currentOther = pending.back().second;
+        pending.pop_back();
+        if (hashOf(currentThis) == hashOf(currentOther))
+        {
+            continue;
+        }
+        if (currentThis != nullptr && currentOther != nullptr &&
+            *(currentThis -> data) == *(currentOther -> data))
+        {
+            pending.push_back(std::make_pair(currentThis -> right, currentOther -> right));
+            pending.push_back(std::make_pair(currentThis -> left, currentOther -> left));
+        }
+        else
+        {
+            mergeHelper(currentThis, currentOther, onlyThis, onlyOther);
+        }
+    }
+} // end of the method diffHelper
+
+// ------------------------------mergeHelper-----------------------------------
+// Description: The method mergeHelper walks the two given subtrees in order
+// side by side, as a merge does, and adds the strings that are in only one
+// of them to the given lists.
+//
+// Parameter: nodeThis, which is the root node of the subtree of this tree.
+//
+// Parameter: nodeOther, which is the root node of the subtree of the other
+// tree.
+//
+// Parameter: onlyThis, which collects the strings only in this tree.
+//
+// Parameter: onlyOther, which collects the strings only in the other tree.
+void BinTree::mergeHelper(TreeNode* nodeThis, TreeNode* nodeOther,
+                          std::vector<const NodeData*>& onlyThis,
+                          std::vector<const NodeData*>& onlyOther) const
+{
+    // Each walk ends at the rightmost node of its subtree.
+    int depth = 0;
+    TreeNode* lastThis = (nodeThis == nullptr) ? nullptr : rightmost(nodeThis, depth);
+    TreeNode* lastOther = (nodeOther == nullptr) ? nullptr : rightmost(nodeOther, depth);
+    TreeNode* currentThis = (nodeThis == nullptr) ? nullptr : leftmost(nodeThis, depth);
+    TreeNode* currentOther = (nodeOther == nullptr) ? nullptr : leftmost(nodeOther, depth);
+    while (currentThis != nullptr || currentOther != nullptr)
+    {
+        int comparison = 0;
+        if (currentThis == nullptr)
+        {
+            comparison = 1;
+        }
+        else if (currentOther == nullptr)
+        {
+            comparison = -1;
+        }
+        else
+        {
+            comparison = compareKey(currentThis -> data -> getData(), currentThis -> summary,
+                                    currentOther);
+        }
+
+        if (comparison <= 0)
+        {
+            if (comparison < 0)
+            {
+                onlyThis.push_back(currentThis -> data);
+            }
+            currentThis = (currentThis == lastThis) ? nullptr : successor(currentThis, depth);
+        }
+        if (comparison >= 0)
+        {
+            if (comparison > 0)
+            {
+                onlyOther.push_back(currentOther -> data);
+            }
+            currentOther = (currentOther == lastOther) ? nullptr : successor(currentOther, depth);
+        }
+    }
+} // end of the method mergeHelper
+
+// -------------------------------outputHelper---------------------------------
+// Description: The method outputHelper outputs the binary tree whose root
+// node is the given tree node through the given ostream object by using
+// inorder traversal.
+//
+// Pre: The given tree node must be the root node of this binary search tree
+// (where this method is initially invoked) or a null pointer.
+//
+// Post: This method displays the binary tree whose root node is the given tree
+// node with inorder traversal. The binary tree does not change.
+//
+// Parameter: output, which is the ostream object through which the binary
+// tree should be outputted.
+//
+// Parameter: rootOutput, which is the root node of the binary tree to output.
+void BinTree::outputHelper(std::ostream& output, TreeNode* rootOutput) const
+{
+    if (rootOutput != nullptr)
+    {
+        int depth = 0;
+        for (TreeNode* node = leftmost(rootOutput, depth); node != nullptr;
+             node = successor(node, depth))
+        {
+            output << *(node -> data) << " ";
+        }
+    }
+} // end of the method outputHelper
+
+// ------------------------------retrieveHelper--------------------------------
+// Description: The method retrieveHelper finds the tree node that contains
+// the given string by descending from the root node.
+//
+// Post: This binary search tree does not change.
+//
+// Parameter: target, which is the string to find.
+//
+// Return: The tree node that contains the given string; a null pointer if
+// the string is not in this binary search tree.
+TreeNode* BinTree::retrieveHelper(std::string_view target) const
+{
+    unsigned long long summary = order.summarize(target);
+    TreeNode* current = root;
+    while (current != nullptr)
+    {
+        // Go left if the given string comes before the string of the current
+        // object, and right if it comes after. Most levels decide on the cached
+        // summaries alone.
+        int comparison = compareKey(target, summary, current);
+        if (comparison < 0)
+        {
+            current = current -> left;
+        }
+        else if (comparison > 0)
+        {
+            current = current -> right;
+        }
+        else
+        {
+            return current;
+        }
+    }
+    return nullptr;
+} // end of the method retrieveHelper
+
+// ------------------------------rankHelper------------------------------------
+// Description: The method rankHelper counts the node data objects in this
+// binary search tree that come before the given string, and the one equal
+// to it if asked to.
+//
+// Parameter: target, which is the string to rank.
+//
+// Parameter: inclusive, which is true to count a node data object equal to
+// the given string.
+//
+// Return: The number of node data objects counted.
+int BinTree::rankHelper(std::string_view target, bool inclusive) const
+{
+    unsigned long long summary = order.summarize(target);
+    int count = 0;
+    TreeNode* current = root;
+    while (current != nullptr)
+    {
+        // Every object in the left subtree comes before the current one, so
+        // going right counts all of them and the current object.
+        int comparison = compareKey(target, summary, current);
+        if (comparison < 0)
+        {
+            current = current -> left;
+        }
+        else if (comparison > 0)
+        {
+            count += sizeOf(current -> left) + 1;
+            current = current -> right;
+        }
+        else
+        {
+            return count + sizeOf(current -> left) + (inclusive ? 1 : 0);
+        }
+    }
+    return count;
+} // end of the method rankHelper
+
+// ------------------------------boundHelper-----------------------------------
+// Description: The method boundHelper finds the first tree node whose string
+// does not come before the given string, or, if asked to, the first one whose
+// string comes after it.
+//
+// Parameter: target, which is the string to search for.
+//
+// Parameter: after, which is true to skip a tree node equal to the string.
+//
+// Return: The tree node found; a null pointer if there is none.
+TreeNode* BinTree::boundHelper(std::string_view target, bool after) const
+{
+    unsigned long long summary = order.summarize(target);
+    TreeNode* found = nullptr;
+    TreeNode* current = root;
+    while (current != nullptr)
+    {
+        // A tree node that qualifies is the answer unless a smaller one in its
+        // left subtree also qualifies.
+        int comparison = compareKey(target, summary, current);
+        if (comparison < 0 || (comparison == 0 && !after))
+        {
+            found = current;
+            current = current -> left;
+        }
+        else
+        {
+            current = current -> right;
+        }
+    }
+    return found;
+} // end of the method boundHelper
+
+// -----------------------------sidewaysHelper---------------------------------
+// Description: The method sidewaysHelper displays the binary tree whose root
+// node is the given tree node as if you are viewing it from the side. It
+// visits the nodes in reverse inorder and indents each one by its depth.
+//
+// Pre: The given tree node should be the root node of this binary search tree
+// (where this method is initially invoked) or a null pointer.
+//
+// Post: The binary tree whose root node is the given tree node does not change.
+//
+// Parameter: rootSideways, which is the root node of the binary tree to
+// display.
+void BinTree::sidewaysHelper(TreeNode* rootSideways) const
+{
+    if (rootSideways != nullptr)
+    {
+        int depth = 0;
+        for (TreeNode* node = rightmost(rootSideways, depth); node != nullptr;
+             node = predecessor(node, depth))
+        {
+            // Indent for readability, 4 spaces per depth level.
+            for (int i = depth + 1; i >= 0; i--) {
+                cout << "    ";
+            }
+
+            cout << *(node -> data) << endl;
+        }
+    }
+} // end of the method sidewaysHelper
+
+// ------------------------------toArrayHelper---------------------------------
+// Description: The method toArrayHelper adds the node data objects in the
+// binary search tree whose root node is the given tree node to the given
+// array based on inorder traversal, and then empties the tree. A node data
+// object stored in a tree node is copied to a dynamically allocated one.
+//
+// Pre: The number of tree nodes in the binary search tree whose root node is
+// the given node cannot be more than the remaining spaces in the array.
+// Finally, the given tree node should be the root node of this binary search
+// tree (where this method is initially invoked).
+//
+// Post: The given array contains the node data objects in the binary search
+// tree whose root node is the given node, and the node data objects are
+// sorted in an increasing order based on the strings they contain. The binary
+// search tree is empty.
+//
+// Parameter: dataArray, which is the array where the node data objects should
+// be contained.
+//
+// Parameter: index, which is the position at which this method starts to add
+// the node data objects to the array.
+//
+// Parameter: rootToArray, which is the root node of the binary search tree
+// to convert.
+void BinTree::toArrayHelper(NodeData* dataArray[], int& index, TreeNode*& rootToArray)
+{
+    if (rootToArray != nullptr)
+    {
+        // Move the node data objects to the array, leaving the tree nodes
+        // without data so that releasing them keeps the objects.
+        int depth = 0;
+        for (TreeNode* node = leftmost(rootToArray, depth); node != nullptr;
+             node = successor(node, depth))
+        {
+            dataArray[index++] = node -> embedded ? new NodeData(*(node -> data)) : node -> data;
+            node -> data = nullptr;
+        }
+        rootToArray = nullptr;
+        pool.release();
+    }
+} // end of the method toArrayHelper
+
+// ------------------------------toTreeHelper----------------------------------
+// Description: The method toTreeHelper creates a balanced binary search tree
+// from a sorted array that contains node data objects.
+//
+// Pre: The given array should be sorted in an increasing order based on the
+// strings that the node data objects contain. There should not be null
+// pointers between the node data objects in the given array.
+//
+// Post: The node data objects in the given array are replaced with null
+// pointers. The given pointer points to the root of a balanced binary search
+// tree that contains the node data objects in the given array. Every node
+// has its parent and height set, and the nodes at the given red depth are
+// red.
+//
+// Parameter: dataArray, which is the array that contains node data objects.
+//
+// Parameter: low, which is the lowest subscript of the array that this
+// recursive call considers.
+//
+// Parameter: high, which is the highest subscript of the array that this
+// recursive call considers.
+//
+// Parameter: rootToTree, which is the pointer that should point to the root
+// node of the created binary search tree.
+//
+// Parameter: parentToTree, which is the tree node that the created tree
+// hangs from.
+//
+// Parameter: depth, which is the depth of the root node of the created
+// tree.
+//
+// Parameter: redDepth, which is the depth whose nodes should be red.
+void BinTree::toTreeHelper(NodeData* dataArray[], int low, int high, TreeNode*& rootToTree,
+                           TreeNode* parentToTree, int depth, int redDepth)
+{
+    // Create a binary search tree if the size of the given array is at least one.
+    if (low <= high)
+    {
+        // The root node of the binary search tree contains the node data object
+        // in the middle of the array.
+        int middle = (low + high) / 2;
+        rootToTree = pool.makeNode(dataArray[middle]);
+        rootToTree -> summary = order.summarize(rootToTree -> data -> getData());
+        rootToTree -> parent = parentToTree;
+        rootToTree -> red = (depth == redDepth && depth > 0);
+        dataArray[middle] = nullptr;
+
+        // Create the left and right subtrees of the root node.
+        toTreeHelper(dataArray, low, middle - 1, rootToTree -> left, rootToTree,
+                     depth + 1, redDepth);
+        toTreeHelper(dataArray, middle + 1, high, rootToTree -> right, rootToTree,
+                     depth + 1, redDepth);
+        update(rootToTree);
+    }
+} // end of the method toTreeHelper
+
+// ------------------------------buildHelper-----------------------------------
+// Description: The method buildHelper checks that the first count node data
+// objects in the given array are sorted and, if they are, builds this binary
+// search tree from them.
+//
+// Pre: This binary search tree should be empty.
+//
+// Parameter: dataArray, which is the array that contains node data objects.
+//
+// Parameter: count, which is the number of node data objects to use.
+//
+// Return: True if this method built the tree, false otherwise.
+bool BinTree::buildHelper(NodeData* dataArray[], int count)
+{
+    if (!isEmpty() || count <= 0)
+    {
+        return false;
+    }
+
+    // Check whether the given array is sorted, comparing the summaries first.
+    unsigned long long previousSummary = order.summarize(dataArray[0] -> getData());
+    for (int index = 1; index < count; index++)
+    {
+        unsigned long long summary = order.summarize(dataArray[index] -> getData());
+        if (previousSummary > summary || (previousSummary == summary &&
+            order.compare(dataArray[index - 1] -> getData(), dataArray[index] -> getData()) >= 0))
+        {
+            return false;
+        }
+        previousSummary = summary;
+    }
+
+    // Use the sorted array to build this binary search tree. Every leaf of the
+    // midpoint tree is on the deepest level, floor(log2 n), or the one above,
+    // so coloring the deepest level red gives every path the same number of
+    // black nodes. The tree nodes are taken from one chunk.
+    int redDepth = 0;
+    for (int remaining = count; remaining > 1; remaining /= 2)
+    {
+        redDepth++;
+    }
+    pool.reserve(count);
+    toTreeHelper(dataArray, 0, count - 1, root, nullptr, 0, redDepth);
+    return true;
+} // end of the method buildHelper
+
+// -------------------------------makeVine-------------------------------------
+// Description: The method makeVine rotates right at every node on the right
+// spine that has a left child, until no node has one.
+//
+// Post: Every tree node is the right child of its inorder predecessor. The
+// cached heights are not correct.
+//
+// Return: The number of tree nodes.
+int BinTree::makeVine()
+{
+    int count = 0;
+    TreeNode* node = root;
+    while (node != nullptr)
+    {
+        if (node -> left != nullptr)
+        {
+            node = rotateRight(node);
+        }
+        else
+        {
+            node = node -> right;
+            count++;
+        }
+    }
+    return count;
+} // end of the method makeVine
+
+// -------------------------------compress-------------------------------------
+// Description: The method compress rotates left at the given number of
+// nodes down the right spine, starting at the root and skipping one node
+// after each rotation, which halves the length of the spine.
+//
+// Parameter: count, which is the number of rotations.
+void BinTree::compress(int count)
+{
+    TreeNode* node = root;
+    for (int rotation = 0; rotation < count; rotation++)
+    {
+        node = rotateLeft(node) -> right;
+    }
+} // end of the method compress
+
+// ------------------------------refreshHelper---------------------------------
+// Description: The method refreshHelper recomputes the cached height of
+// every tree node, children before parents, and colors the nodes at the
+// given depth red and the others black.
+//
+// Parameter: redDepth, which is the depth whose nodes should be red.
+void BinTree::refreshHelper(int redDepth)
+{
+    int depth = 0;
+    for (TreeNode* node = root; node != nullptr; node = nextPreorder(node, root, depth))
+    {
+        node -> red = (depth == redDepth && depth > 0);
+    }
+
+    // Visit the nodes in postorder: descend to the first leaf, and after a
+    // left child go to the first leaf under its sibling.
+    TreeNode* node = root;
+    while (true)
+    {
+        while (node -> left != nullptr || node -> right != nullptr)
+        {
+            node = (node -> left != nullptr) ? node -> left : node -> right;
+        }
+        update(node);
+        TreeNode* parent = node -> parent;
+        while (parent != nullptr && (node == parent -> right || parent -> right == nullptr))
+        {
+            node = parent;
+            update(node);
+            parent = node -> parent;
+        }
+        if (parent == nullptr)
+        {
+            return;
+        }
+        node = parent -> right;
+    }
+} // end of the method refreshHelper
+
+// ------------------------------appendHelper----------------------------------
+// Description: The method appendHelper adds the given string during
+// buildFromSorted: as the right child of the tail if it comes after the
+// tail, not at all if it equals the tail, and to the list of late strings if
+// it comes before it. If this tree was not empty when the build started, it
+// inserts the string instead.
+//
+// Parameter: key, which is the string to add.
+//
+// Parameter: tail, which is the last tree node added; a null pointer before
+// the first one.
+//
+// Parameter: late, which holds the strings that came out of order.
+void BinTree::appendHelper(const std::string& key, TreeNode*& tail, std::vector<std::string>& late)
+{
+    if (tail == nullptr && root != nullptr)
+    {
+        insert(key);
+        return;
+    }
+
+    unsigned long long summary = order.summarize(key);
+    int comparison = (tail == nullptr) ? 1 : compareKey(key, summary, tail);
+    if (comparison < 0)
+    {
+        late.push_back(key);
+    }
+    else if (comparison > 0)
+    {
+        // The heights, sizes and colors are set when the chain is balanced.
+        TreeNode* newNode = pool.makeNode(key);
+        newNode -> summary = summary;
+        newNode -> parent = tail;
+        if (tail == nullptr)
+        {
+            root = newNode;
+        }
+        else
+        {
+            tail -> right = newNode;
+        }
+        tail = newNode;
+    }
+} // end of the method appendHelper
+
+// ------------------------------finishHelper----------------------------------
+// Description: The method finishHelper balances the chain that appendHelper
+// built and inserts the strings that came out of order.
+//
+// Parameter: tail, which is the last tree node added; a null pointer if
+// appendHelper added none.
+//
+// Parameter: late, which holds the strings that came out of order.
+void BinTree::finishHelper(TreeNode* tail, std::vector<std::string>& late)
+{
+    if (tail != nullptr)
+    {
+        rebalance();
+    }
+    for (size_t index = 0; index < late.size(); index++)
+    {
+        insert(late[index]);
+    }
+} // end of the method finishHelper
+
+// -----------------------------parallelHelper---------------------------------
+// Description: The method parallelHelper builds the midpoint tree of the
+// given sorted strings in the tree nodes made for them, copying each string
+// into its tree node, in the same way as
+// toTreeHelper. The string at position i goes to the tree node at position i,
+// so two threads never touch the same tree node, and it hands the left
+// subtree to a new thread while more than one thread is left.
+//
+// Parameter: keys, which point to the sorted strings without duplicates.
+//
+// Parameter: nodes, which are the tree nodes, one per string.
+//
+// Parameter: low, which is the lowest position that this call considers.
+//
+// Parameter: high, which is the highest position that this call considers.
+//
+// Parameter: parentToTree, which is the tree node that the created tree
+// hangs from.
+//
+// Parameter: depth, which is the depth of the root node of the created
+// tree.
+//
+// Parameter: redDepth, which is the depth whose nodes should be red.
+//
+// Parameter: threadCount, which is the number of threads for this subtree.
+//
+// Return: The root node of the created tree; a null pointer if the range is
+// empty.
+TreeNode* BinTree::parallelHelper(const std::vector<const std::string*>& keys, TreeNode* nodes,
+                                  int low, int high, TreeNode* parentToTree, int depth,
+                                  int redDepth, unsigned threadCount)
+{
+    if (low > high)
+    {
+        return nullptr;
+    }
+
+    int middle = (low + high) / 2;
+    TreeNode* rootToTree = nodes + middle;
+    rootToTree -> data = new (rootToTree -> storage) NodeData(*keys[middle]);
+    rootToTree -> embedded = true;
+    rootToTree -> summary = order.summarize(*keys[middle]);
+    rootToTree -> parent = parentToTree;
+    rootToTree -> red = (depth == redDepth && depth > 0);
+
+    if (threadCount < 2 || high - low < SERIAL_CUTOFF)
+    {
+        rootToTree -> left = parallelHelper(keys, nodes, low, middle - 1, rootToTree, depth + 1,
+                                            redDepth, 1);
+        rootToTree -> right = parallelHelper(keys, nodes, middle + 1, high, rootToTree, depth + 1,
+                                             redDepth, 1);
+    }
+    else
+    {
+        std::thread leftTree([&]()
+        {
+            rootToTree -> left = parallelHelper(keys, nodes, low, middle - 1, rootToTree,
+                                                depth + 1, redDepth, threadCount / 2);
+        });
+        rootToTree -> right = parallelHelper(keys, nodes, middle + 1, high, rootToTree, depth + 1,
+                                             redDepth, threadCount - threadCount / 2);
+        leftTree.join();
+    }
+    update(rootToTree);
+    return rootToTree;
+} // end of the method parallelHelper
+
+// ---------------------------------linkHelper---------------------------------
+// Description: The method linkHelper links the given tree nodes, which hold
+// sorted strings, into their midpoint tree, in the same way as toTreeHelper.
+//
+// Parameter: nodes, which are the tree nodes.
+//
+// Parameter: low, which is the lowest position that this call considers.
+//
+// Parameter: high, which is the highest position that this call considers.
+//
+// Parameter: parentToTree, which is the tree node that the linked tree hangs
+// from.
+//
+// Parameter: depth, which is the depth of the root node of the linked tree.
+//
+// Parameter: redDepth, which is the depth whose nodes should be red.
+//
+// Return: The root node of the linked tree; a null pointer if the range is
+// empty.
+TreeNode* BinTree::linkHelper(TreeNode* nodes, int low, int high, TreeNode* parentToTree,
+                              int depth, int redDepth)
+{
+    if (low > high)
+    {
+        return nullptr;
+    }
+
+    int middle = (low + high) / 2;
+    TreeNode* rootToTree = nodes + middle;
+    rootToTree -> parent = parentToTree;
+    rootToTree -> red = (depth == redDepth && depth > 0);
+    rootToTree -> left = linkHelper(nodes, low, middle - 1, rootToTree, depth + 1, redDepth);
+    rootToTree -> right = linkHelper(nodes, middle + 1, high, rootToTree, depth + 1, redDepth);
+    update(rootToTree);
+    return rootToTree;
+} // end of the method linkHelper
+
+// --------------------------------combine-------------------------------------
+// Description: The method combine replaces this binary search tree with the
+// strings of this tree and the given tree that the given parts select. It
+// merges the strings of both trees in order and builds a balanced tree from
+// the result, so it takes O(n + m) time for trees of n and m strings and
+// allocates the new tree nodes in one chunk. With more than one thread, the
+// merge is split at the middle string of the larger tree, and the halves are
+// merged and built at the same time. The old tree nodes are freed only after
+// the new ones hold copies of their strings.
+//
+// Parameter: other, which is the binary search tree to combine with.
+//
+// Parameter: parts, which is the set of SetPart values to keep.
+//
+// Parameter: threadCount, the number of threads to use; zero uses one per
+// core.
+void BinTree::combine(const BinTree& other, int parts, unsigned threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<TreeNode*> thisNodes;
+    std::vector<TreeNode*> otherNodes;
+    inorderNodes(root, thisNodes);
+    inorderNodes(other.root, otherNodes);
+    std::vector<const std::string*> keys;
+    combineHelper(thisNodes.data(), thisNodes.data() + thisNodes.size(), otherNodes.data(),
+                  otherNodes.data() + otherNodes.size(), parts, keys, threadCount);
+
+    // The keys point into the old tree nodes, so the new tree is built in a
+    // pool of its own and the pools are swapped afterwards.
+    int count = static_cast<int>(keys.size());
+    int redDepth = 0;
+    for (int remaining = count; remaining > 1; remaining /= 2)
+    {
+        redDepth++;
+    }
+    BinTree result(mode, order);
+    TreeNode* nodes = result.pool.makeNodes(keys.size());
+    result.root = result.parallelHelper(keys, nodes, 0, count - 1, nullptr, 0, redDepth,
+                                        threadCount);
+    std::swap(root, result.root);
+    pool.swap(result.pool);
+} // end of the method combine
+
+// -----------------------------combineHelper----------------------------------
+// Description: The method combineHelper merges the given sorted ranges of
+// tree nodes of this tree and of another tree, and adds the strings that the
+// given parts select to the given list in order. With more than one thread,
+// it splits both ranges at the middle string of the larger one, merges the
+// lower halves in a new thread, and joins the two lists.
+//
+// Parameter: thisFirst, which is the first tree node of this tree.
+//
+// Parameter: thisLast, which is just after the last tree node of this tree.
+//
+// Parameter: otherFirst, which is the first tree node of the other tree.
+//
+// Parameter: otherLast, which is just after the last tree node of the other
+// tree.
+//
+// Parameter: parts, which is the set of SetPart values to keep.
+//
+// Parameter: keys, to which the strings are added.
+//
+// Parameter: threadCount, which is the number of threads for the ranges.
+void BinTree::combineHelper(TreeNode* const* thisFirst, TreeNode* const* thisLast,
+                            TreeNode* const* otherFirst, TreeNode* const* otherLast, int parts,
+                            std::vector<const std::string*>& keys, unsigned threadCount) const
+{
+    if (threadCount >= 2 && (thisLast - thisFirst) + (otherLast - otherFirst) >= SERIAL_CUTOFF)
+    {
+        // A string equal to the middle one goes to the upper halves of both
+        // ranges, so each string meets its match in the same half.
+        auto before = [this](const TreeNode* node, const TreeNode* middle)
+        {
+            return compareKey(node -> data -> getData(), node -> summary, middle) < 0;
+        };
+        TreeNode* const* thisMiddle;
+        TreeNode* const* otherMiddle;
+        if (thisLast - thisFirst >= otherLast - otherFirst)
+        {
+            thisMiddle = thisFirst + (thisLast - thisFirst) / 2;
+            otherMiddle = std::lower_bound(otherFirst, otherLast, *thisMiddle, before);
+        }
+        else
+        {
+            otherMiddle = otherFirst + (otherLast - otherFirst) / 2;
+            thisMiddle = std::lower_bound(thisFirst, thisLast, *otherMiddle, before);
+        }
+
+        std::vector<const std::string*> upperKeys;
+        std::thread lowerHalf([&]()
+        {
+            combineHelper(thisFirst, thisMiddle, otherFirst, otherMiddle, parts, keys,
+                          threadCount / 2);
+        });
+        combineHelper(thisMiddle, thisLast, otherMiddle, otherLast, parts, upperKeys,
+                      threadCount - threadCount / 2);
+        lowerHalf.join();
+        keys.insert(keys.end(), upperKeys.begin(), upperKeys.end());
+        return;
     }
-    // Return false if only one given node is a null pointer.
-    else if (rootThis == nullptr || rootOther == nullptr)
+
+    while (thisFirst != thisLast && otherFirst != otherLast)
     {
-        return false;
+        const std::string& key = (*thisFirst) -> data -> getData();
+        int comparison = compareKey(key, (*thisFirst) -> summary, *otherFirst);
+        if (comparison < 0)
+        {
+            if (parts & ONLY_THIS)
+            {
+                keys.push_back(&key);
+            }
+            thisFirst++;
+        }
+        else if (comparison > 0)
+        {
+            if (parts & ONLY_OTHER)
+            {
+                keys.push_back(&(*otherFirst) -> data -> getData());
+            }
+            otherFirst++;
+        }
+        else
+        {
+            if (parts & IN_BOTH)
+            {
+                keys.push_back(&key);
+            }
+            thisFirst++;
+            otherFirst++;
+        }
     }
-    // Return false if the two given nodes have different data items.
-    else if (*(rootThis -> data) != *(rootOther -> data))
+    for (; thisFirst != thisLast && (parts & ONLY_THIS); thisFirst++)
     {
-        return false;
+        keys.push_back(&(*thisFirst) -> data -> getData());
     }
-    // Check the subtrees of the two given nodes.
-    else
+    for (; otherFirst != otherLast && (parts & ONLY_OTHER); otherFirst++)
     {
-        return compareHelper(rootThis -> left, rootOther -> left) &&
-               compareHelper(rootThis -> right, rootOther -> right);
+        keys.push_back(&(*otherFirst) -> data -> getData());
     }
-} // end of the method compareHelper
+} // end of the method combineHelper
 
-// -------------------------------outputHelper---------------------------------
-// Description: The method outputHelper outputs the binary tree whose root
-// node is the given tree node through the given ostream object by using
-// inorder traversal.
+// ------------------------------inorderNodes----------------------------------
+// Description: The method inorderNodes lists the tree nodes of the given
+// tree in the key order.
 //
-// Pre: The given tree node must be a node of this binary search tree (where
-// this method is initially invoked).
+// Parameter: top, which is the root node of the tree.
 //
-// Post: This method displays the binary tree whose root node is the given tree
-// node with inorder traversal. The binary tree does not change.
+// Parameter: nodes, which receives the tree nodes.
+void BinTree::inorderNodes(TreeNode* top, std::vector<TreeNode*>& nodes)
+{
+    if (top == nullptr)
+    {
+        return;
+    }
+    nodes.reserve(top -> size);
+    int depth = 0;
+    TreeNode* last = rightmost(top, depth);
+    for (TreeNode* node = leftmost(top, depth); node != last; node = successor(node, depth))
+    {
+        nodes.push_back(node);
+    }
+    nodes.push_back(last);
+} // end of the method inorderNodes
+
+// -------------------------------compareKey-----------------------------------
+// Description: The method compareKey orders the given string and the one in
+// the given tree node, calling the compare function of the key order only
+// when the summaries tie.
 //
-// Parameter: output, which is the ostream object through which the binary
-// tree should be outputted.
+// Parameter: target, which is the string to compare.
 //
-// Parameter: rootOutput, which is the root node of the binary tree to output
-// within this recursive call.
-void BinTree::outputHelper(std::ostream& output, TreeNode* rootOutput) const
+// Parameter: summary, which is the summary of the given string.
+//
+// Parameter: node, which is the tree node to compare with.
+//
+// Return: A negative number if the given string comes first, zero if the
+// strings are equal, and a positive number if the given string comes last.
+int BinTree::compareKey(std::string_view target, unsigned long long summary, const TreeNode* node) const
 {
-    // Output the binary tree whose root node is the given tree node if the
-    // given tree node is not a null pointer.
-    if (rootOutput != nullptr)
+    if (summary != node -> summary)
     {
-        outputHelper(output, rootOutput -> left);
-        output << *(rootOutput -> data) << " ";
-        outputHelper(output, rootOutput -> right);
+        return (summary < node -> summary) ? -1 : 1;
     }
-} // end of the method outputHelper
+    return order.compare(target, node -> data -> getData());
+} // end of the method compareKey
 
-// ------------------------------retrieveHelper--------------------------------
-// Description: The method retrieveHelper finds the given node data object in
-// the binary search tree whose root node is the given node and set the given
-// pointer to the address of the given object in the tree.
+// --------------------------------findLink------------------------------------
+// Description: The method findLink finds where a tree node with the given
+// string belongs in this binary search tree.
 //
-// Pre: The given node must be a node of this binary search tree.
+// Parameter: target, which is the string to place.
 //
-// Post: The given pointer will point to the given node data object in the
-// binary search tree if the given object is in the tree. The given pointer
-// will point to garbage if the given object is not in the tree.
+// Parameter: summary, which is the summary of the given string.
 //
-// Parameter: target, which is the object to retrieve.
+// Parameter: parent, which becomes the tree node that the new tree node
+// should hang from; a null pointer if this tree is empty.
 //
-// Parameter: pointer, which will point to the given object if it is in the
-// tree.
+// Return: The child pointer that should point to the new tree node; a null
+// pointer if the given string is already in this tree.
+TreeNode** BinTree::findLink(std::string_view target, unsigned long long summary, TreeNode*& parent)
+{
+    TreeNode** link = &root;
+    parent = nullptr;
+    while (*link != nullptr)
+    {
+        parent = *link;
+
+        // Go left if the given string comes before the string of the current
+        // node data object, and right if it comes after.
+        int comparison = compareKey(target, summary, parent);
+        if (comparison < 0)
+        {
+            link = &(parent -> left);
+        }
+        else if (comparison > 0)
+        {
+            link = &(parent -> right);
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+    return link;
+} // end of the method findLink
+
+// ---------------------------------attach-------------------------------------
+// Description: The method attach hangs the given new tree node at the place
+// that findLink found and rebalances this binary search tree.
 //
-// Parameter: rootRetrieve, which is the root node of the binary search tree
-// that this recursive call considers.
+// Parameter: newNode, which is the tree node to add.
 //
-// Return: True if this method found the given object, false otherwise.
-bool BinTree::retrieveHelper
-(const NodeData& target, NodeData*& pointer, TreeNode* rootRetrieve) const
+// Parameter: link, which is the child pointer that findLink returned.
+//
+// Parameter: parent, which is the parent that findLink found.
+void BinTree::attach(TreeNode* newNode, TreeNode** link, TreeNode* parent)
 {
-    // The given node data object is not in the tree if the root node is a null
-    // pointer.
-    if (rootRetrieve == nullptr)
+    *link = newNode;
+    newNode -> parent = parent;
+    updateHash(newNode);
+
+    // Every ancestor gains one node. The rotations below recompute sizes from
+    // the children, so they must already be correct.
+    for (TreeNode* ancestor = parent; ancestor != nullptr; ancestor = ancestor -> parent)
     {
-        return false;
+        ancestor -> size++;
     }
-    // Go left if the string of the given node data object is less than the
-    // string of the object of the root node.
-    else if (target < *(rootRetrieve -> data))
+
+    // Restore the balance that the new leaf may have broken. The AVL walk
+    // updates the heights on its way; the other modes update them first, so
+    // that the red-black rotations start from correct heights.
+    if (mode == AVL)
     {
-        return retrieveHelper(target, pointer, rootRetrieve -> left);
+        rebalanceAvl(parent);
     }
-    // Go right if the string of the given node data object is greater than the
-    // string of the object of the root node.
-    else if (target > *(rootRetrieve -> data))
+    else
     {
-        return retrieveHelper(target, pointer, rootRetrieve -> right);
+        updateAncestors(parent);
+        if (mode == RED_BLACK)
+        {
+            newNode -> red = true;
+            rebalanceRedBlack(newNode);
+        }
     }
-    // Update the pointer if the given node data object and the object of the
-    // root node have the same string.
-    else
+
+    // The walks above stop once the heights settle, but the hash of every
+    // subtree that holds the new leaf has changed. Only those hashes can be
+    // stale: a rotation rehashes the nodes it moves from their children, and
+    // a node that does not end up above the new leaf has children that never
+    // held it.
+    for (TreeNode* ancestor = newNode -> parent; ancestor != nullptr; ancestor = ancestor -> parent)
     {
-        pointer = rootRetrieve -> data;
-        return true;
+        updateHash(ancestor);
     }
-} // end of the method retrieveHelper
+} // end of the method attach
 
-// -------------------------------heightHelper---------------------------------
-// Description: The method heightHelper searches for the tree node that
-// contains the given node data object within the binary tree whose root node
-// is the given node and reports the height of the node that contains the
-// object.
+// -------------------------------heightOf-------------------------------------
+// Description: The method heightOf returns the cached height of the given
+// subtree.
 //
-// Pre: The given node data object should be in this binary search tree (where
-// this method is initially invoked). The given tree node should be a node of
-// this binary search tree.
+// Parameter: node, which is the root node of the subtree.
 //
-// Post: The binary tree whose root node is the given tree node does not
-// change.
+// Return: The height of the subtree; zero for a null pointer.
+int BinTree::heightOf(const TreeNode* node)
+{
+    return node == nullptr ? 0 : node -> height;
+} // end of the method heightOf
+
+// --------------------------------sizeOf--------------------------------------
+// Description: The method sizeOf returns the cached size of the given
+// subtree.
 //
-// Parameter: target, which is the node data object whose height should be
-// reported.
+// Parameter: node, which is the root node of the subtree.
+//
+// Return: The number of tree nodes in the subtree; zero for a null pointer.
+int BinTree::sizeOf(const TreeNode* node)
+{
+    return node == nullptr ? 0 : node -> size;
+} // end of the method sizeOf
+
+// --------------------------------hashOf--------------------------------------
+// Description: The method hashOf returns the cached hash of the given
+// subtree.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Return: The hash of the subtree; zero for a null pointer.
+unsigned long long BinTree::hashOf(const TreeNode* node)
+{
+    return node == nullptr ? 0 : node -> hash;
+} // end of the method hashOf
+
+// --------------------------------update--------------------------------------
+// Description: The method update recomputes the cached height, size and
+// hash of the given tree node from those of its children.
+//
+// Pre: The heights, sizes and hashes of the children of the given node must
+// be correct.
+//
+// Parameter: node, which is the tree node to update.
+void BinTree::update(TreeNode* node)
+{
+    int left = heightOf(node -> left);
+    int right = heightOf(node -> right);
+    node -> height = (left > right ? left : right) + 1;
+    node -> size = sizeOf(node -> left) + sizeOf(node -> right) + 1;
+    updateHash(node);
+} // end of the method update
+
+// ------------------------------updateHash------------------------------------
+// Description: The method updateHash recomputes the cached hash of the given
+// tree node from its string and the hashes of its children.
+//
+// Pre: The hashes of the children of the given node must be correct.
+//
+// Parameter: node, which is the tree node to update.
+void BinTree::updateHash(TreeNode* node)
+{
+    // The children are mixed in one after the other, so swapping them
+    // changes the hash.
+    unsigned long long hash = summarizeHash(node -> data -> getData());
+    hash = mixHash(hash ^ hashOf(node -> left));
+    hash = mixHash(hash + hashOf(node -> right) * 0x9e3779b97f4a7c15ULL);
+    node -> hash = hash;
+} // end of the method updateHash
+
+// ----------------------------updateAncestors---------------------------------
+// Description: The method updateAncestors recomputes the cached heights from
+// the given tree node toward the root, stopping at the first node whose
+// height does not change, since the nodes above it cannot change either.
 //
-// Parameter: rootGetHeight, which is the root node of the binary tree that
-// this recursive call considers.
+// Pre: The heights of the children of the given node must be correct.
+//
+// Parameter: node, which is the first tree node to update; it may be a null
+// pointer.
+void BinTree::updateAncestors(TreeNode* node)
+{
+    while (node != nullptr)
+    {
+        int previousHeight = node -> height;
+        update(node);
+        if (node -> height == previousHeight)
+        {
+            return;
+        }
+        node = node -> parent;
+    }
+} // end of the method updateAncestors
+
+// ------------------------------replaceChild----------------------------------
+// Description: The method replaceChild makes the parent of the given node,
+// or the root pointer if the given node is the root, point to another node.
 //
-// Parameter: height, which is the cumulative height of the given node data
-// object. If this is greater than zero, the tree node that contains the
-// object is an ascendant of the binary tree whose root node is the given
-// tree node.
+// Parameter: node, which is the tree node to replace.
 //
-// Return: The height of the given node data object; zero if the object does
-// not exist in the binary tree whose root node is the given node.
-int BinTree::heightHelper
-(const NodeData& target, TreeNode* rootGetHeight, int height) const
+// Parameter: replacement, which is the tree node that takes its place.
+void BinTree::replaceChild(TreeNode* node, TreeNode* replacement)
 {
-    // Return the cumulative height if the root node is a null pointer.
-    if (rootGetHeight == nullptr)
+    TreeNode* parent = node -> parent;
+    if (parent == nullptr)
+    {
+        root = replacement;
+    }
+    else if (parent -> left == node)
     {
-        return height;
+        parent -> left = replacement;
     }
     else
     {
-        // Add one to the cumulative height if the tree node that contains the
-        // given node data object is an ascendant or the given tree node contains
-        // the given node data.
-        if (height > 0 || target == *(rootGetHeight -> data))
-        {
-            height++;
-        }
+        parent -> right = replacement;
+    }
+    if (replacement != nullptr)
+    {
+        replacement -> parent = parent;
+    }
+} // end of the method replaceChild
 
-        // Return the longer path to a leaf node.
-        int left = heightHelper(target, rootGetHeight -> left, height);
-        int right = heightHelper(target, rootGetHeight -> right, height);
-        return left > right ? left : right;
+// -------------------------------rotateLeft-----------------------------------
+// Description: The method rotateLeft lifts the right child of the given node
+// into its place and makes the given node its left child.
+//
+// Pre: The given node must have a right child.
+//
+// Post: The inorder sequence of this binary search tree does not change. The
+// heights of the two nodes are updated.
+//
+// Parameter: node, which is the tree node to lower.
+//
+// Return: The tree node that took the place of the given node.
+TreeNode* BinTree::rotateLeft(TreeNode* node)
+{
+    TreeNode* raised = node -> right;
+    replaceChild(node, raised);
+
+    node -> right = raised -> left;
+    if (raised -> left != nullptr)
+    {
+        raised -> left -> parent = node;
     }
-} // end of the method heightHelper
+    raised -> left = node;
+    node -> parent = raised;
 
-// -----------------------------sidewaysHelper---------------------------------
-// Description: The method sidewaysHelper displays the binary tree whose root
-// node is the given tree node as if you are viewing it from the side.
+    // The lowered node is now below the raised one, so it is updated first.
+    update(node);
+    update(raised);
+    return raised;
+} // end of the method rotateLeft
+
+// -------------------------------rotateRight----------------------------------
+// Description: The method rotateRight lifts the left child of the given node
+// into its place and makes the given node its right child.
 //
-// Pre: The given tree node should be a node of this binary search tree (where
-// this method is initially invoked).
+// Pre: The given node must have a left child.
 //
-// Post: The binary tree whose root node is the given tree node does not change.
+// Post: The inorder sequence of this binary search tree does not change. The
+// heights of the two nodes are updated.
 //
-// Parameter: rootSideways, which is the root node of the binary tree that this
-// recursive call considers.
+// Parameter: node, which is the tree node to lower.
 //
-// Parameter: level, which is an integer that determines the indentation.
-void BinTree::sidewaysHelper(TreeNode* rootSideways, int level) const
+// Return: The tree node that took the place of the given node.
+TreeNode* BinTree::rotateRight(TreeNode* node)
 {
-    // Display the tree if the given node is not a null pointer.
-    if (rootSideways != nullptr)
+    TreeNode* raised = node -> left;
+    replaceChild(node, raised);
+
+    node -> left = raised -> right;
+    if (raised -> right != nullptr)
+    {
+        raised -> right -> parent = node;
+    }
+    raised -> right = node;
+    node -> parent = raised;
+
+    update(node);
+    update(raised);
+    return raised;
+} // end of the method rotateRight
+
+// ------------------------------rebalanceAvl----------------------------------
+// Description: The method rebalanceAvl walks from the given node toward the
+// root, updating heights, and rotates at the first node whose subtrees
+// differ in height by two. After an insert one single or double rotation is
+// enough, because it restores the height the subtree had before.
+//
+// Parameter: node, which is the parent of the tree node just inserted.
+void BinTree::rebalanceAvl(TreeNode* node)
+{
+    while (node != nullptr)
     {
-        level++;
-        sidewaysHelper(rootSideways -> right, level);
+        int previousHeight = node -> height;
+        update(node);
+        int balance = heightOf(node -> left) - heightOf(node -> right);
 
-        // Indent for readability, 4 spaces per depth level.
-        for (int i = level; i >= 0; i--) {
-            cout << "    ";
+        if (balance > 1)
+        {
+            // The left subtree is too tall; a right-heavy left child needs a
+            // double rotation.
+            if (heightOf(node -> left -> left) < heightOf(node -> left -> right))
+            {
+                rotateLeft(node -> left);
+            }
+            rotateRight(node);
+            return;
+        }
+        else if (balance < -1)
+        {
+            if (heightOf(node -> right -> right) < heightOf(node -> right -> left))
+            {
+                rotateRight(node -> right);
+            }
+            rotateLeft(node);
+            return;
         }
 
-        cout << *(rootSideways -> data) << endl;
-        sidewaysHelper(rootSideways -> left, level);
+        // The ancestors cannot change if this subtree kept its height.
+        if (node -> height == previousHeight)
+        {
+            return;
+        }
+        node = node -> parent;
     }
-} // end of the method sidewaysHelper
+} // end of the method rebalanceAvl
 
-// ------------------------------toArrayHelper---------------------------------
-// Description: The method toArrayHelper adds the node data objects in the
-// binary search tree whose root node is the given tree node to the given
-// array based on inorder traversal.
+// ---------------------------rebalanceRedBlack--------------------------------
+// Description: The method rebalanceRedBlack recolors and rotates until the
+// given red node no longer has a red parent, and then colors the root black.
 //
-// Pre: The given array should be a statically allocated array whose size is
-// 100. The number of tree nodes in the binary search tree whose root node is
-// the given node cannot be more than the remaining spaces in the array.
-// Finally, the given tree node should be a node of this binary search tree
-// (where this method is initially invoked).
-//
-// Post: The given array contains the node data objects in the binary search
-// tree whose root node is the given node, and the node data objects are
-// sorted in an increasing order based on the strings they contain. The binary
-// search tree is empty.
-//
-// Parameter: dataArray, which is the array where the node data objects should
-// be contained.
-//
-// Parameter: index, which is the position at which this method starts to add
-// the node data objects to the array.
+// Parameter: node, which is the red tree node just inserted.
 //
-// Parameter: rootToArray, which is the root node of the binary search tree
-// that this recursive call consider.
-void BinTree::toArrayHelper(NodeData* dataArray[], int& index, TreeNode*& rootToArray)
+// Return: True if the root was red before this method colored it black,
+// which makes the black height of the tree one larger; false otherwise.
+bool BinTree::rebalanceRedBlack(TreeNode* node)
 {
-    // Add the node data objects in the tree to the given array if the given root
-    // node is not a null pointer.
-    if (rootToArray != nullptr)
+    while (node -> parent != nullptr && node -> parent -> red)
     {
-        // Add the node data objects in the left subtree to the given array and
-        // empty the left subtree.
-        toArrayHelper(dataArray, index, rootToArray -> left);
+        // The parent is red, so it is not the root and the grandparent exists.
+        TreeNode* parent = node -> parent;
+        TreeNode* grandparent = parent -> parent;
+        bool parentIsLeft = (grandparent -> left == parent);
+        TreeNode* uncle = parentIsLeft ? grandparent -> right : grandparent -> left;
+
+        // A red uncle: push the blackness of the grandparent down and continue
+        // from the grandparent.
+        if (uncle != nullptr && uncle -> red)
+        {
+            parent -> red = false;
+            uncle -> red = false;
+            grandparent -> red = true;
+            node = grandparent;
+        }
+        // A black uncle: at most two rotations finish the fix.
+        else
+        {
+            if (parentIsLeft && node == parent -> right)
+            {
+                rotateLeft(parent);
+                parent = node;
+            }
+            else if (!parentIsLeft && node == parent -> left)
+            {
+                rotateRight(parent);
+                parent = node;
+            }
 
-        // Add the node data object of the given node to the given array.
-        dataArray[index] = rootToArray -> data;
-        rootToArray -> data = nullptr;
+            parent -> red = false;
+            grandparent -> red = true;
+            TreeNode* raised = parentIsLeft ? rotateRight(grandparent) : rotateLeft(grandparent);
 
-        // Add the node data objects in the right subtree to the given array and
-        // empty the right subtree.
-        toArrayHelper(dataArray, ++index, rootToArray -> right);
+            // The rotated subtree may be shorter than before, so the heights
+            // above it may drop.
+            updateAncestors(raised -> parent);
+            break;
+        }
+    }
+    bool grew = root -> red;
+    root -> red = false;
+    return grew;
+} // end of the method rebalanceRedBlack
 
-        // Delete the given node.
-        delete rootToArray;
-        rootToArray = nullptr;
+// --------------------------------rebalanceJoin--------------------------------
+// Description: The method rebalanceJoin walks from the given node to the
+// root, updating every node and rotating wherever the subtrees differ in
+// height by two. Unlike after an insert, a join can leave the subtree taller
+// after a rotation, so the walk never stops early.
+//
+// Parameter: node, which is the first tree node to update.
+void BinTree::rebalanceJoin(TreeNode* node)
+{
+    while (node != nullptr)
+    {
+        update(node);
+        int balance = heightOf(node -> left) - heightOf(node -> right);
+        if (balance > 1)
+        {
+            if (heightOf(node -> left -> left) < heightOf(node -> left -> right))
+            {
+                rotateLeft(node -> left);
+            }
+            node = rotateRight(node);
+        }
+        else if (balance < -1)
+        {
+            if (heightOf(node -> right -> right) < heightOf(node -> right -> left))
+            {
+                rotateRight(node -> right);
+            }
+            node = rotateLeft(node);
+        }
+        node = node -> parent;
     }
-} // end of the method toArrayHelper
+} // end of the method rebalanceJoin
 
-// ------------------------------toTreeHelper----------------------------------
-// Description: The method toTreeHelper creates a balanced binary search tree
-// from a sorted array that contains node data objects.
+// --------------------------------blackHeightOf--------------------------------
+// Description: The method blackHeightOf counts the black tree nodes on the
+// path from the given node to its leftmost null link, which is the same for
+// every path in a red-black tree.
 //
-// Pre: The given array should be sorted in an increasing order based on the
-// strings that the node data objects contain. There should not be null
-// pointers between the node data objects in the given array.
+// Parameter: node, which is the root node of the subtree.
 //
-// Post: The node data objects in the given array are replaced with null
-// pointers. The given pointer points to the root of a balanced binary search
-// tree that contains the node data objects in the given array.
+// Return: The black height; zero for a null pointer.
+int BinTree::blackHeightOf(const TreeNode* node)
+{
+    int blackHeight = 0;
+    for (; node != nullptr; node = node -> left)
+    {
+        if (!node -> red)
+        {
+            blackHeight++;
+        }
+    }
+    return blackHeight;
+} // end of the method blackHeightOf
+
+// ---------------------------------joinHelper----------------------------------
+// Description: The method joinHelper builds one balanced tree from the given
+// subtrees and the given tree node between them. A subtree that is much
+// taller than the other gets the other hung from the node, in the place of a
+// subtree of about the same height on its inner path; the AVL and red-black
+// rules are then restored on the way back up. It takes time proportional to
+// the difference of the heights, or of the black heights in the red-black
+// mode.
 //
-// Parameter: dataArray, which is the array that contains node data objects.
+// Pre: Every string of the lower subtree comes before the one in the given
+// node and every string of the upper subtree after it. The subtrees are
+// valid in the balance mode of this tree, except that their roots may be
+// red.
 //
-// Parameter: low, which is the lowest subscript of the array that this
-// recursive call considers.
+// Post: The root of this tree points to the joined tree, whose root node has
+// no parent.
 //
-// Parameter: high, which is the highest subscript of the array that this
-// recursive call considers.
+// Parameter: lower, which is the root node of the lower subtree.
 //
-// Parameter: rootToTree, which is the pointer that should point to the root
-// node of the created binary search tree.
-void BinTree::toTreeHelper
-(NodeData* dataArray[], int low, int high, TreeNode*& rootToTree)
+// Parameter: middle, which is the tree node to put between the subtrees.
+//
+// Parameter: upper, which is the root node of the upper subtree.
+//
+// Parameter: lowerBlack, which is the black height of the lower subtree; it
+// is used only in the red-black mode.
+//
+// Parameter: upperBlack, which is the black height of the upper subtree; it
+// is used only in the red-black mode.
+//
+// Return: The black height of the joined tree in the red-black mode.
+int BinTree::joinHelper(TreeNode* lower, TreeNode* middle, TreeNode* upper, int lowerBlack,
+                        int upperBlack)
 {
-    // Create a binary search tree if the size of the given array is at least one.
-    if (low <= high)
+    if (lower != nullptr)
     {
-        // The root node of the binary search tree contains the node data object
-        // in the middle of the array.
-        int middle = (low + high) / 2;
-        rootToTree = new TreeNode(dataArray[middle], nullptr, nullptr);
-        dataArray[middle] = nullptr;
+        lower -> parent = nullptr;
+    }
+    if (upper != nullptr)
+    {
+        upper -> parent = nullptr;
+    }
+    middle -> parent = nullptr;
+    middle -> red = false;
 
-        // Create the left and right subtrees of the root node.
-        toTreeHelper(dataArray, low, middle - 1, rootToTree -> left);
-        toTreeHelper(dataArray, middle + 1, high, rootToTree -> right);
+    // A red root may be colored black, which keeps a subtree valid and makes
+    // its black height one larger.
+    if (mode == RED_BLACK && lower != nullptr && lower -> red)
+    {
+        lower -> red = false;
+        lowerBlack++;
+    }
+    if (mode == RED_BLACK && upper != nullptr && upper -> red)
+    {
+        upper -> red = false;
+        upperBlack++;
+    }
+
+    // Find where the shorter subtree belongs on the inner path of the taller
+    // one: a subtree of at most one level taller in the AVL mode, or a black
+    // subtree of the same black height in the red-black mode. Otherwise the
+    // given node becomes the root.
+    bool lowerTaller = false;
+    bool upperTaller = false;
+    if (mode == AVL)
+    {
+        lowerTaller = heightOf(lower) > heightOf(upper) + 1;
+        upperTaller = heightOf(upper) > heightOf(lower) + 1;
+    }
+    else if (mode == RED_BLACK)
+    {
+        lowerTaller = lowerBlack > upperBlack;
+        upperTaller = upperBlack > lowerBlack;
+    }
+
+    if (!lowerTaller && !upperTaller)
+    {
+        middle -> left = lower;
+        middle -> right = upper;
+        if (lower != nullptr)
+        {
+            lower -> parent = middle;
+        }
+        if (upper != nullptr)
+        {
+            upper -> parent = middle;
+        }
+        update(middle);
+        root = middle;
+        return (mode == RED_BLACK) ? lowerBlack + 1 : 0;
+    }
+
+    TreeNode* parent = nullptr;
+    TreeNode* spine = lowerTaller ? lower : upper;
+    TreeNode* shorter = lowerTaller ? upper : lower;
+    int spineBlack = lowerTaller ? lowerBlack : upperBlack;
+    int shorterBlack = lowerTaller ? upperBlack : lowerBlack;
+    while ((mode == AVL && heightOf(spine) > heightOf(shorter) + 1) ||
+           (mode == RED_BLACK && (spine != nullptr && (spine -> red || spineBlack > shorterBlack))))
+    {
+        if (!spine -> red)
+        {
+            spineBlack--;
+        }
+        parent = spine;
+        spine = lowerTaller ? spine -> right : spine -> left;
+    }
+
+    // The given node takes the place of the subtree found, with that subtree
+    // and the shorter one as its children.
+    root = lowerTaller ? lower : upper;
+    middle -> left = lowerTaller ? spine : shorter;
+    middle -> right = lowerTaller ? shorter : spine;
+    middle -> parent = parent;
+    if (middle -> left != nullptr)
+    {
+        middle -> left -> parent = middle;
+    }
+    if (middle -> right != nullptr)
+    {
+        middle -> right -> parent = middle;
+    }
+    if (lowerTaller)
+    {
+        parent -> right = middle;
+    }
+    else
+    {
+        parent -> left = middle;
+    }
+
+    if (mode == AVL)
+    {
+        rebalanceJoin(middle);
+        return 0;
+    }
+
+    // Every node above the given one gained its subtree. The red node may
+    // then have a red parent, which is the same repair as after an insert;
+    // the repair stops updating heights early, so the hashes above it are
+    // brought up to date afterwards.
+    for (TreeNode* ancestor = middle; ancestor != nullptr; ancestor = ancestor -> parent)
+    {
+        update(ancestor);
+    }
+    middle -> red = true;
+    int blackHeight = lowerTaller ? lowerBlack : upperBlack;
+    if (rebalanceRedBlack(middle))
+    {
+        blackHeight++;
+    }
+    for (TreeNode* ancestor = middle -> parent; ancestor != nullptr; ancestor = ancestor -> parent)
+    {
+        updateHash(ancestor);
     }
-} // end of the method toTreeHelper
\ No newline at end of file
+    return blackHeight;
+} // end of the method joinHelper
\ No newline at end of file
@@ -1,8 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "nodepool.h"
 #include "treenode.h"
 
+class StaticIndex;
+
 // -------------------------------- bintree.h -------------------------------------
 // Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
 // Creation Date: 4/5/2022
@@ -17,17 +25,188 @@
 // also supports accessors that can traverse through the tree, retrieve a data item
 // in the tree, or report the height of a data item. Finally, my binary search tree
 // can be converted to a sorted array or be created from a sorted array.
+//
+// Note: By default my binary search tree does not rebalance, so keys that arrive
+// in sorted order build a tree as deep as the number of keys. A tree created in
+// the AVL or the red-black mode rebalances after every insert and keeps its
+// height in O(log n).
+//
+// Note: Every tree node also caches a hash of its subtree, so two trees whose
+// root hashes differ are unequal without a walk, and diff skips every pair of
+// subtrees whose hashes match.
+//
+// Note: The order of the keys is a KeyOrder, which sorts the node data objects by
+// an integer summary first and by a three-way comparison only when the summaries
+// tie. Every tree node caches the summary of its key, so one search does one
+// comparison per level and usually only of integers. The default order is the
+// order of the strings.
 // --------------------------------------------------------------------------------
 
 class BinTree
 {
 public:
+    // The ways that insert can keep this binary search tree balanced.
+    enum BalanceMode
+    {
+        UNBALANCED,
+        AVL,
+        RED_BLACK
+    };
+
+    // A key order on the strings of the node data objects. The summary of a
+    // string must not decrease as the string moves later in the order, so that
+    // different summaries already order two strings; compare orders two
+    // strings whose summaries are equal and returns a negative number, zero or
+    // a positive number. A summary that is always zero leaves every comparison
+    // to compare. Both take string views, so a search by a string view never
+    // builds a node data object.
+    struct KeyOrder
+    {
+        unsigned long long (*summarize)(std::string_view key);
+        int (*compare)(std::string_view lhs, std::string_view rhs);
+    };
+
+    // The order of the strings, summarized by their first eight bytes.
+    static const KeyOrder LEXICAL_ORDER;
+
+    // Shorter strings first, and strings of the same length in the order of
+    // the strings.
+    static const KeyOrder LENGTH_FIRST_ORDER;
+
+    // The order of a 64-bit hash of the strings, and of the strings when the
+    // hashes are equal. Its comparisons almost never read a string, but the
+    // inorder traversal looks random.
+    static const KeyOrder HASH_ORDER;
+
+    // A bidirectional iterator over the node data objects of a binary search
+    // tree in its key order. It follows the parent pointers of the tree nodes,
+    // so it holds no stack and allocates nothing. Insert never moves a tree
+    // node, so an iterator stays valid until its tree is emptied, assigned or
+    // converted to an array.
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef NodeData value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const NodeData* pointer;
+        typedef const NodeData& reference;
+
+        // ---------------------------Default Constructor------------------------------
+        // Description: The default constructor creates an iterator that does not
+        // belong to any tree.
+        Iterator();
+
+        // -------------------------------operator *-----------------------------------
+        // Description: The operator * returns the node data object that this
+        // iterator is at.
+        //
+        // Pre: This iterator must not be at the end of its tree.
+        //
+        // Return: A reference to the node data object.
+        const NodeData& operator*() const;
+
+        // -------------------------------operator ->----------------------------------
+        // Description: The operator -> returns the node data object that this
+        // iterator is at.
+        //
+        // Pre: This iterator must not be at the end of its tree.
+        //
+        // Return: A pointer to the node data object.
+        const NodeData* operator->() const;
+
+        // -------------------------------operator ++----------------------------------
+        // Description: The operator ++ moves this iterator to the next node data
+        // object, or to the end after the last one. It takes O(1) amortized time.
+        //
+        // Return: A reference to this iterator.
+        Iterator& operator++();
+
+        // -------------------------------operator ++----------------------------------
+        // Description: The postfix operator ++ moves this iterator forward.
+        //
+        // Return: A copy of this iterator from before it moved.
+        Iterator operator++(int);
+
+        // -------------------------------operator -- ---------------------------------
+        // Description: The operator -- moves this iterator to the previous node
+        // data object, or from the end to the last one.
+        //
+        // Return: A reference to this iterator.
+        Iterator& operator--();
+
+        // -------------------------------operator -- ---------------------------------
+        // Description: The postfix operator -- moves this iterator backward.
+        //
+        // Return: A copy of this iterator from before it moved.
+        Iterator operator--(int);
+
+        // -------------------------------operator ==----------------------------------
+        // Description: The operator == reports whether two iterators are at the
+        // same place.
+        //
+        // Parameter: rhs, the iterator to compare with.
+        //
+        // Return: True if both are at the same tree node or both at the end.
+        bool operator==(const Iterator& rhs) const;
+
+        // -------------------------------operator !=----------------------------------
+        // Description: The operator != reports whether two iterators are at
+        // different places.
+        //
+        // Parameter: rhs, the iterator to compare with.
+        //
+        // Return: True if they are at different places.
+        bool operator!=(const Iterator& rhs) const;
+
+    private:
+        // The tree, which the end iterator needs in order to step back to the
+        // last node, and the current tree node; a null pointer at the end.
+        const BinTree* tree;
+        TreeNode* node;
+
+        // ------------------------Parametrized Constructor----------------------------
+        // Description: The parametrized constructor creates an iterator at the given
+        // tree node of the given tree.
+        //
+        // Parameter: tree, the tree to iterate over.
+        //
+        // Parameter: node, the tree node to start at; a null pointer for the end.
+        Iterator(const BinTree* tree, TreeNode* node);
+
+        friend class BinTree;
+    };
+
+    typedef Iterator iterator;
+    typedef Iterator const_iterator;
+
     // ---------------------------Default Constructor------------------------------
-    // Description: The default constructor creates an empty tree.
+    // Description: The default constructor creates an empty tree that does not
+    // rebalance.
     //
     // Post: An empty tree, whose root node is a null pointer, exists.
     BinTree();
 
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates an empty tree that
+    // rebalances in the given mode.
+    //
+    // Post: An empty tree, whose root node is a null pointer, exists.
+    //
+    // Parameter: mode, which is how insert keeps this tree balanced.
+    explicit BinTree(BalanceMode mode);
+
+    // ------------------------Parametrized Constructor----------------------------
+    // Description: This parametrized constructor creates an empty tree that
+    // rebalances in the given mode and sorts its keys in the given order.
+    //
+    // Post: An empty tree, whose root node is a null pointer, exists.
+    //
+    // Parameter: mode, which is how insert keeps this tree balanced.
+    //
+    // Parameter: order, which is the order of the keys in this tree.
+    BinTree(BalanceMode mode, const KeyOrder& order);
+
     // ------------------------------Copy Constructor------------------------------
     // Description: The copy constructor copies the given binary search tree and
     // creates a new binary search tree that is the same as the given one.
@@ -35,7 +214,8 @@ public:
     // Pre: The given tree must be a binary search tree.
     //
     // Post: A new binary search tree that is the same as the given binary search
-    // tree exists.
+    // tree exists. It has the same structure, balance mode and key order as the
+    // given tree.
     //
     // Parameter: other, which is the binary search tree to copy.
     BinTree(const BinTree& other);
@@ -48,6 +228,20 @@ public:
     // memory is free.
     ~BinTree();
 
+    // ----------------------------getBalanceMode----------------------------------
+    // Description: The method getBalanceMode reports how insert keeps this
+    // binary search tree balanced.
+    //
+    // Return: The balance mode of this binary search tree.
+    BalanceMode getBalanceMode() const;
+
+    // -----------------------------getKeyOrder------------------------------------
+    // Description: The method getKeyOrder reports the order of the keys in this
+    // binary search tree.
+    //
+    // Return: The key order of this binary search tree.
+    KeyOrder getKeyOrder() const;
+
     // -------------------------------isEmpty--------------------------------------
     // Description: The method isEmpty reports whether this binary search tree is
     // empty.
@@ -58,9 +252,20 @@ public:
     // pointer); false otherwise.
     bool isEmpty() const;
 
+    // --------------------------------getSize-------------------------------------
+    // Description: The method getSize reports the number of node data objects in
+    // this binary search tree, which the root node caches.
+    //
+    // Post: This binary search tree does not change.
+    //
+    // Return: The number of node data objects.
+    int getSize() const;
+
     // -------------------------------makeEmpty------------------------------------
     // Description: The method makeEmpty empties this binary search tree, freeing
-    // the memory that is dynamically allocated to each node in this tree.
+    // the memory that is dynamically allocated to each node in this tree. The
+    // nodes live in the node pool of this tree, so this frees a few chunks
+    // instead of every node.
     //
     // Post: This binary search tree is empty (the root node is a null pointer).
     // The dynamically allocated memory is free.
@@ -69,12 +274,13 @@ public:
     // ------------------------------operator = -----------------------------------
     // Description: The method operator= overloads the operator =, assigning the
     // binary search tree on the right-hand side of the operator = to this binary
-    // search tree, which is on the left-hand side.
+    // search tree, which is on the left-hand side. The tree is copied node for
+    // node, and the new nodes are allocated together in one chunk.
     //
     // Pre: The tree on the right-hand side must be a binary search tree.
     //
     // Post: This binary search tree is the same as the one on the right-hand
-    // side.
+    // side. It has the same structure, balance mode and key order.
     //
     // Parameter: rhs, the binary search tree to assign to this one.
     //
@@ -106,6 +312,30 @@ public:
     // otherwise.
     bool operator!=(const BinTree& rhs) const;
 
+    // ---------------------------------diff---------------------------------------
+    // Description: The method diff finds the strings that are in only one of this
+    // binary search tree and the given one. It descends both trees in step and
+    // skips every pair of subtrees whose hashes match, so when the trees have the
+    // same shape apart from d differing strings it takes O(d log n) time. Where the
+    // shapes differ, it merges the two subtrees in order, which takes time linear
+    // in their sizes.
+    //
+    // Pre: Both trees should use the same key order.
+    //
+    // Post: Both binary search trees do not change. Subtrees whose hashes match
+    // are taken to be equal, which two different subtrees are with a chance of
+    // about one in 2^64.
+    //
+    // Parameter: other, which is the binary search tree to compare with.
+    //
+    // Parameter: onlyThis, to which the node data objects of this tree that are
+    // not in the given tree are added.
+    //
+    // Parameter: onlyOther, to which the node data objects of the given tree that
+    // are not in this tree are added.
+    void diff(const BinTree& other, std::vector<const NodeData*>& onlyThis,
+              std::vector<const NodeData*>& onlyOther) const;
+
     // ---------------------------------insert-------------------------------------
     // Description: The method insert adds a tree node with the given node data
     // object, which contains a string, to this binary search tree.
@@ -115,7 +345,8 @@ public:
     // dynamically allocated.
     //
     // Post: A tree node with the given node data object is added to this binary
-    // search tree, and this binary search tree is still valid. If the same node
+    // search tree, and this binary search tree is still valid. In the AVL and
+    // red-black modes, this binary search tree is rebalanced. If the same node
     // data object have already been inserted into this binary search tree, this
     // method does nothing.
     //
@@ -126,6 +357,129 @@ public:
     // object to this binary search tree; false if this method did nothing.
     bool insert(NodeData* newData);
 
+    // ---------------------------------insert-------------------------------------
+    // Description: The method insert adds a tree node with a node data object
+    // that contains the given string to this binary search tree. It searches
+    // before it allocates, so a duplicate string costs no allocation, and the
+    // node data object is stored in the new tree node itself.
+    //
+    // Pre: This binary search tree must be valid based on the strings that the
+    // node data objects in this tree contain.
+    //
+    // Post: A tree node with a node data object that contains the given string
+    // is added to this binary search tree, and this binary search tree is still
+    // valid. In the AVL and red-black modes, this binary search tree is
+    // rebalanced. If the string is already in this binary search tree, this
+    // method does nothing.
+    //
+    // Parameter: value, the string to insert into this binary search tree.
+    //
+    // Return: True if this method added a tree node; false if this method did
+    // nothing.
+    bool insert(const std::string& value);
+
+    // -----------------------------buildFromSorted--------------------------------
+    // Description: The method buildFromSorted adds the strings in the given range,
+    // which should be sorted in the key order of this tree, in O(n) time. It links
+    // each new string as the right child of the one before, which needs no search
+    // and no array, and then balances the chain in place with rebalance.
+    //
+    // Pre: The strings should be sorted in the key order of this tree.
+    //
+    // Post: This binary search tree contains the strings, each once, and is
+    // balanced in the same way as after rebalance. A string that repeats the one
+    // before it is skipped, as insert would. A string that comes before the one
+    // before it is inserted after the build, so unsorted input gives a correct
+    // tree but costs more time. If this tree is not empty, every string is
+    // inserted.
+    //
+    // Parameter: first, the iterator at the first string.
+    //
+    // Parameter: last, the iterator just after the last string.
+    template <class InputIterator>
+    void buildFromSorted(InputIterator first, InputIterator last);
+
+    // -----------------------------buildFromSorted--------------------------------
+    // Description: The method buildFromSorted reads strings separated by white
+    // space from the given stream until it ends and adds them in the same way as
+    // the version for a range, holding no more than one string at a time.
+    //
+    // Pre: The strings should be sorted in the key order of this tree.
+    //
+    // Post: This binary search tree contains the strings that were read, in the
+    // same way as after the version for a range.
+    //
+    // Parameter: input, the stream to read.
+    void buildFromSorted(std::istream& input);
+
+    // ---------------------------buildFromUnsorted--------------------------------
+    // Description: The method buildFromUnsorted adds the given strings, in any
+    // order, with several threads. The threads sort the strings by merge sort,
+    // each sorting a part and then merging pairs of parts, the duplicates are
+    // removed, and the threads build the left and right subtrees of the midpoint
+    // tree at the same time, splitting again at each level until every thread
+    // has a subtree of its own.
+    //
+    // Post: This binary search tree contains the strings, each once, and is
+    // balanced in the same way as after arrayToBSTree. If this tree is not empty,
+    // every string is inserted instead.
+    //
+    // Parameter: keys, the strings to add, which the method sorts; pass it with
+    // std::move to avoid copying them.
+    //
+    // Parameter: threadCount, the number of threads to use; zero uses one per
+    // core.
+    void buildFromUnsorted(std::vector<std::string> keys, unsigned threadCount = 0);
+
+    // ------------------------------------save-------------------------------------
+    // Description: The method save writes the strings of this binary search tree
+    // to the given stream as a binary image, in the key order and with their
+    // lengths in front, in the format that the TreeFormat class describes. With
+    // front coding, each string stores only the bytes that differ from the one
+    // before, except at every restart point.
+    //
+    // Post: This binary search tree does not change.
+    //
+    // Parameter: output, which is the stream to write to; it should be opened in
+    // binary mode.
+    //
+    // Parameter: frontCoding, which is whether strings share their leading bytes
+    // with the string before.
+    //
+    // Return: True if the stream took the whole image; false otherwise.
+    bool save(std::ostream& output, bool frontCoding = true) const;
+
+    // ------------------------------------load-------------------------------------
+    // Description: The method load replaces the strings of this binary search tree
+    // with those in the binary image that the given stream holds. The image lists
+    // the strings in order, so each is decoded straight into its tree node, and
+    // the nodes are linked into a balanced tree in O(n) time.
+    //
+    // Pre: The image should come from a tree with the same key order.
+    //
+    // Post: This binary search tree holds the strings of the image and is
+    // balanced in the same way as after buildFromUnsorted. If the image is not
+    // valid or its strings are not in the key order of this tree, this tree is
+    // empty.
+    //
+    // Parameter: input, which is the stream to read to its end; it should be
+    // opened in binary mode.
+    //
+    // Return: True if the image was loaded; false otherwise.
+    bool load(std::istream& input);
+
+    // -------------------------------toStaticIndex--------------------------------
+    // Description: The method toStaticIndex copies the strings of this binary
+    // search tree into a read-only index in Eytzinger order, whose searches walk
+    // one array with no pointers and no branches on the comparisons. It takes O(n)
+    // time.
+    //
+    // Post: This binary search tree does not change, and later changes to it do
+    // not change the index.
+    //
+    // Return: The index, which orders its strings in the key order of this tree.
+    StaticIndex toStaticIndex() const;
+
     // ------------------------------operator << ----------------------------------
     // Description: The method operator << overloads the operator<<, displaying
     // the given binary search tree, which is on the right-hand side of the
@@ -160,9 +514,53 @@ public:
     // Return: True if this method found the given object, false otherwise.
     bool retrieve(const NodeData& target, NodeData*& pointer) const;
 
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method finds the node data object that contains
+    // the given string in this binary search tree without creating a node data
+    // object, so a lookup by a string view or a C string allocates nothing.
+    //
+    // Post: The given pointer will point to the node data object with the given
+    // string if the string is in this tree. Otherwise, the given pointer does not
+    // change.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Parameter: pointer, which will point to the node data object if the string
+    // is in this tree.
+    //
+    // Return: True if this method found the string, false otherwise.
+    bool retrieve(std::string_view key, NodeData*& pointer) const;
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method finds the node data object that contains
+    // the given string, in the same way as the string view version. It and the
+    // C string version exist so that such an argument does not have to choose
+    // between converting to a node data object and to a string view.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Parameter: pointer, which will point to the node data object if the string
+    // is in this tree.
+    //
+    // Return: True if this method found the string, false otherwise.
+    bool retrieve(const std::string& key, NodeData*& pointer) const;
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method finds the node data object that contains
+    // the given C string, in the same way as the string view version.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Parameter: pointer, which will point to the node data object if the string
+    // is in this tree.
+    //
+    // Return: True if this method found the string, false otherwise.
+    bool retrieve(const char* key, NodeData*& pointer) const;
+
     // -------------------------------getHeight------------------------------------
     // Description: The method getHeight reports the height of the tree node that
-    // contains the given node data object.
+    // contains the given node data object. It descends to the node and reads the
+    // height that the node caches, so it takes O(h) time for a tree of height h.
     //
     // Pre: The given node data object should be in this binary search tree.
     //
@@ -175,6 +573,107 @@ public:
     // does not exist in this binary search tree.
     int getHeight(const NodeData& target) const;
 
+    // ---------------------------------rank---------------------------------------
+    // Description: The method rank counts the node data objects in this binary
+    // search tree that come before the given one in its key order. It descends
+    // once and adds up the subtree sizes that the tree nodes cache, so it takes
+    // O(h) time for a tree of height h.
+    //
+    // Post: This binary search tree does not change.
+    //
+    // Parameter: target, which is the node data object to rank; it does not
+    // have to be in this tree.
+    //
+    // Return: The number of node data objects less than the given one, which
+    // is also its position, counting from zero, if it is in this tree.
+    int rank(const NodeData& target) const;
+
+    // --------------------------------select--------------------------------------
+    // Description: The method select finds the node data object at the given
+    // position in the key order of this binary search tree, so select(0) finds
+    // the smallest one. It takes O(h) time for a tree of height h.
+    //
+    // Post: The given pointer will point to the node data object at the given
+    // position if the position is less than the size of this tree. Otherwise,
+    // the given pointer does not change.
+    //
+    // Parameter: position, which is the number of node data objects before the
+    // one to find.
+    //
+    // Parameter: pointer, which will point to the node data object found.
+    //
+    // Return: True if this method found a node data object, false otherwise.
+    bool select(int position, NodeData*& pointer) const;
+
+    // ------------------------------countRange------------------------------------
+    // Description: The method countRange counts the node data objects in this
+    // binary search tree from the given low one to the given high one,
+    // inclusive, with two descents. It takes O(h) time for a tree of height h.
+    //
+    // Post: This binary search tree does not change.
+    //
+    // Parameter: low, which is the smallest node data object to count.
+    //
+    // Parameter: high, which is the largest node data object to count.
+    //
+    // Return: The number of node data objects in the range; zero if the high
+    // one comes before the low one.
+    int countRange(const NodeData& low, const NodeData& high) const;
+
+    // ---------------------------------begin--------------------------------------
+    // Description: The method begin returns an iterator at the smallest node
+    // data object in this binary search tree.
+    //
+    // Return: The iterator; the end iterator if this tree is empty.
+    Iterator begin() const;
+
+    // ----------------------------------end---------------------------------------
+    // Description: The method end returns the iterator just after the largest
+    // node data object in this binary search tree.
+    //
+    // Return: The end iterator.
+    Iterator end() const;
+
+    // ------------------------------lowerBound------------------------------------
+    // Description: The method lowerBound finds the first node data object in
+    // this binary search tree that does not come before the given one. It
+    // descends once, so it takes O(h) time for a tree of height h.
+    //
+    // Parameter: target, which is the node data object to search for; it does
+    // not have to be in this tree.
+    //
+    // Return: An iterator at the node data object found; the end iterator if
+    // every object comes before the given one.
+    Iterator lowerBound(const NodeData& target) const;
+
+    // ------------------------------upperBound------------------------------------
+    // Description: The method upperBound finds the first node data object in
+    // this binary search tree that comes after the given one, in the same way
+    // as lowerBound.
+    //
+    // Parameter: target, which is the node data object to search for.
+    //
+    // Return: An iterator at the node data object found; the end iterator if
+    // no object comes after the given one.
+    Iterator upperBound(const NodeData& target) const;
+
+    // ----------------------------forEachInRange----------------------------------
+    // Description: The method forEachInRange passes every node data object from
+    // the given low one to the given high one, inclusive, to the given function
+    // in the key order. It descends once and then walks the k objects in the
+    // range, so it takes O(h + k) time and prints or allocates nothing.
+    //
+    // Post: This binary search tree does not change.
+    //
+    // Parameter: low, which is the smallest node data object to visit.
+    //
+    // Parameter: high, which is the largest node data object to visit.
+    //
+    // Parameter: visit, which is called as visit(data) with a constant
+    // reference to each node data object.
+    template <class Visit>
+    void forEachInRange(const NodeData& low, const NodeData& high, Visit visit) const;
+
     // ----------------------------displaySideways---------------------------------
     // Description: The method displaySideways displays this binary search tree as
     // though you are viewing it from the side.
@@ -186,13 +685,14 @@ public:
     // Description: The method bstreeToArray adds the node data objects in this
     // binary search tree to the given array based on inorder traversal.
     //
-    // Pre: The given array should be a statically allocated array which has 100
-    // null pointers. The number of tree nodes in this binary search tree cannot be
-    // greater than 100.
+    // Pre: The given array should have a null pointer for every tree node in this
+    // binary search tree, from the first position on.
     //
     // Post: The given array contains the node data objects in this binary search
-    // tree, and the node data objects are sorted in an increasing order based on
-    // the strings they contain. This binary search tree is empty.
+    // tree, and the node data objects are sorted in the key order of this tree,
+    // which by default is the order of their strings. A node data object that was
+    // stored in a tree node is copied to a dynamically allocated one. This binary
+    // search tree is empty.
     //
     // Parameter: dataArray, which is the array where the node data objects should
     // be contained.
@@ -202,61 +702,495 @@ public:
     // Description: The method arrayToBSTree creates a balanced binary search tree
     // from a sorted array that contains node data objects.
     //
-    // Pre: The given array should be of size 100 and be sorted in an increasing
-    // order based on the strings that the node data objects contain. This binary
-    // search tree should be empty. Finally, there should not be null pointers
-    // between the node data objects in the given array.
+    // Pre: The given array should be of size 100 and be sorted in the key order of
+    // this tree, which by default is the order of the strings that the node data
+    // objects contain. This binary search tree should be empty. Finally, there
+    // should not be null pointers between the node data objects in the given array.
     //
     // Post: The node data objects in the given array are replaced with null
     // pointers. This binary search tree is a balanced tree which contains the node
-    // data objects that the given array contained. If the given array is not
-    // sorted or this binary search tree is not empty when this method is invoked,
-    // this method does nothing. If there are null pointers between the node data
-    // objects in the given array, this method considers the node data objects
-    // before the first null pointer.
+    // data objects that the given array contained. The tree is also a valid AVL
+    // tree and, with the nodes on its deepest level colored red, a valid red-black
+    // tree. If the given array is not sorted or this binary search tree is not
+    // empty when this method is invoked, this method does nothing. If there are
+    // null pointers between the node data objects in the given array, this method
+    // considers the node data objects before the first null pointer.
     //
     // Parameter: dataArray, which is the array that contains node data objects.
     void arrayToBSTree(NodeData* dataArray[]);
 
+    // -----------------------------bstreeToArray----------------------------------
+    // Description: The method bstreeToArray moves the node data objects in this
+    // binary search tree to the given vector based on inorder traversal. The
+    // vector grows to fit, so the tree can have any number of nodes.
+    //
+    // Post: The given vector contains only the node data objects in this binary
+    // search tree, sorted in the key order of this tree. A node data object that
+    // was stored in a tree node is copied to a dynamically allocated one. This
+    // binary search tree is empty.
+    //
+    // Parameter: dataArray, which is the vector where the node data objects
+    // should be contained.
+    void bstreeToArray(std::vector<NodeData*>& dataArray);
+
+    // -----------------------------arrayToBSTree----------------------------------
+    // Description: The method arrayToBSTree creates a balanced binary search tree
+    // from the first count node data objects in the given array. It checks the
+    // order and builds the tree in one pass each, so it takes O(n) time.
+    //
+    // Pre: The first count entries of the given array should be dynamically
+    // allocated node data objects sorted in the key order of this tree. This
+    // binary search tree should be empty.
+    //
+    // Post: The first count entries of the given array are replaced with null
+    // pointers, and this binary search tree is balanced in the same way as the
+    // version for an array of size 100. If the entries are not sorted or this
+    // binary search tree is not empty, this method does nothing.
+    //
+    // Parameter: dataArray, which is the array that contains node data objects.
+    //
+    // Parameter: count, which is the number of node data objects to use.
+    void arrayToBSTree(NodeData* dataArray[], int count);
+
+    // -----------------------------arrayToBSTree----------------------------------
+    // Description: The method arrayToBSTree creates a balanced binary search tree
+    // from every node data object in the given vector, in the same way as the
+    // version that takes a count.
+    //
+    // Post: If this binary search tree was built, the given vector is empty.
+    // Otherwise neither this tree nor the vector changes.
+    //
+    // Parameter: dataArray, which is the vector that contains node data objects.
+    void arrayToBSTree(std::vector<NodeData*>& dataArray);
+
+    // -------------------------------rebalance------------------------------------
+    // Description: The method rebalance reshapes this binary search tree into a
+    // balanced one in place with the Day-Stout-Warren algorithm: it rotates the
+    // tree into a vine, a chain of right children, and then compresses the vine
+    // with rounds of left rotations. It takes O(n) time and needs no array.
+    //
+    // Post: This binary search tree contains the same node data objects and has
+    // the smallest possible height, with every level full except the deepest.
+    // The tree is a valid AVL tree and, with the nodes on its deepest level
+    // colored red, a valid red-black tree.
+    void rebalance();
+
+    // ------------------------------------unite------------------------------------
+    // Description: The method unite makes this binary search tree the union of
+    // itself and the given tree.
+    //
+    // Pre: Both trees should use the same key order.
+    //
+    // Post: This binary search tree contains every string that was in either
+    // tree, balanced in the same way as after buildFromUnsorted. The given tree
+    // does not change.
+    //
+    // Parameter: other, which is the binary search tree to combine with.
+    //
+    // Parameter: threadCount, the number of threads to use; zero uses one per
+    // core.
+    void unite(const BinTree& other, unsigned threadCount = 1);
+
+    // ----------------------------------intersect----------------------------------
+    // Description: The method intersect keeps only the strings of this binary
+    // search tree that are also in the given tree.
+    //
+    // Pre: Both trees should use the same key order.
+    //
+    // Post: This binary search tree contains the strings that were in both
+    // trees, balanced in the same way as after buildFromUnsorted. The given tree
+    // does not change.
+    //
+    // Parameter: other, which is the binary search tree to combine with.
+    //
+    // Parameter: threadCount, the number of threads to use; zero uses one per
+    // core.
+    void intersect(const BinTree& other, unsigned threadCount = 1);
+
+    // ----------------------------------subtract-----------------------------------
+    // Description: The method subtract removes the strings that are in the given
+    // tree from this binary search tree.
+    //
+    // Pre: Both trees should use the same key order.
+    //
+    // Post: This binary search tree contains the strings that were in it but
+    // not in the given tree, balanced in the same way as after buildFromUnsorted.
+    // The given tree does not change.
+    //
+    // Parameter: other, which is the binary search tree to combine with.
+    //
+    // Parameter: threadCount, the number of threads to use; zero uses one per
+    // core.
+    void subtract(const BinTree& other, unsigned threadCount = 1);
+
+    // ------------------------------------split------------------------------------
+    // Description: The method split moves the tree nodes whose strings come at or
+    // after the given string into the given tree, and keeps the rest. It cuts
+    // the search path for the string into subtrees and joins them back into two
+    // trees, so it takes O(log n) time in the AVL and red-black modes; no node
+    // data object is copied or allocated.
+    //
+    // Pre: The given tree is not this tree.
+    //
+    // Post: This binary search tree contains the strings before the given one,
+    // and the given tree, which takes the balance mode and key order of this
+    // tree, contains the others. What the given tree held before is gone. The two
+    // trees share the chunks that held the tree nodes until both release them,
+    // but each allocates new tree nodes on its own, so they can be used by
+    // different threads.
+    //
+    // Parameter: key, which is the first string to move.
+    //
+    // Parameter: upper, which receives the strings from the given one on.
+    void split(const NodeData& key, BinTree& upper);
+
+    // ------------------------------------join-------------------------------------
+    // Description: The method join moves every tree node of the given tree into
+    // this binary search tree, whose strings must all come before those of the
+    // given tree. It takes the first tree node of the given tree out along its
+    // left path and hangs the two trees from it, so it takes O(log n) time in
+    // the AVL and red-black modes and copies no node data object.
+    //
+    // Post: If this tree and the given tree have the same balance mode and key
+    // order and every string of this tree comes before every string of the given
+    // tree, this tree contains the strings of both, the given tree is empty, and
+    // this tree takes over its chunks. Otherwise neither tree changes.
+    //
+    // Parameter: upper, which is the tree whose strings come after those of this
+    // tree.
+    //
+    // Return: True if the trees were joined; false otherwise.
+    bool join(BinTree& upper);
+
 private:
+    // The parts of two trees that combine keeps: the strings only in this
+    // tree, the ones only in the other tree, and the ones in both.
+    enum SetPart
+    {
+        ONLY_THIS = 1,
+        ONLY_OTHER = 2,
+        IN_BOTH = 4
+    };
+
     TreeNode* root;
+    BalanceMode mode;
+    KeyOrder order;
+
+    // The tree nodes of this binary search tree and the node data objects that
+    // it copies or creates itself.
+    NodePool pool;
+
+    // -------------------------------compareKey-----------------------------------
+    // Description: The method compareKey orders the given string and the one in
+    // the given tree node, calling the compare function of the key order only
+    // when the summaries tie.
+    //
+    // Parameter: target, which is the string to compare.
+    //
+    // Parameter: summary, which is the summary of the given string.
+    //
+    // Parameter: node, which is the tree node to compare with.
+    //
+    // Return: A negative number if the given string comes first, zero if the
+    // strings are equal, and a positive number if the given string comes last.
+    int compareKey(std::string_view target, unsigned long long summary, const TreeNode* node) const;
+
+    // --------------------------------findLink------------------------------------
+    // Description: The method findLink finds where a tree node with the given
+    // string belongs in this binary search tree.
+    //
+    // Parameter: target, which is the string to place.
+    //
+    // Parameter: summary, which is the summary of the given string.
+    //
+    // Parameter: parent, which becomes the tree node that the new tree node
+    // should hang from; a null pointer if this tree is empty.
+    //
+    // Return: The child pointer that should point to the new tree node; a null
+    // pointer if the given string is already in this tree.
+    TreeNode** findLink(std::string_view target, unsigned long long summary, TreeNode*& parent);
+
+    // ---------------------------------attach-------------------------------------
+    // Description: The method attach hangs the given new tree node at the place
+    // that findLink found and rebalances this binary search tree.
+    //
+    // Parameter: newNode, which is the tree node to add.
+    //
+    // Parameter: link, which is the child pointer that findLink returned.
+    //
+    // Parameter: parent, which is the parent that findLink found.
+    void attach(TreeNode* newNode, TreeNode** link, TreeNode* parent);
+
+    // -------------------------------heightOf-------------------------------------
+    // Description: The method heightOf returns the cached height of the given
+    // subtree.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The height of the subtree; zero for a null pointer.
+    static int heightOf(const TreeNode* node);
+
+    // --------------------------------sizeOf--------------------------------------
+    // Description: The method sizeOf returns the cached size of the given
+    // subtree.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The number of tree nodes in the subtree; zero for a null pointer.
+    static int sizeOf(const TreeNode* node);
+
+    // --------------------------------hashOf--------------------------------------
+    // Description: The method hashOf returns the cached hash of the given
+    // subtree.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The hash of the subtree; zero for a null pointer.
+    static unsigned long long hashOf(const TreeNode* node);
+
+    // --------------------------------update--------------------------------------
+    // Description: The method update recomputes the cached height, size and
+    // hash of the given tree node from those of its children.
+    //
+    // Pre: The heights, sizes and hashes of the children of the given node must
+    // be correct.
+    //
+    // Parameter: node, which is the tree node to update.
+    static void update(TreeNode* node);
+
+    // ------------------------------updateHash------------------------------------
+    // Description: The method updateHash recomputes the cached hash of the given
+    // tree node from its string and the hashes of its children.
+    //
+    // Pre: The hashes of the children of the given node must be correct.
+    //
+    // Parameter: node, which is the tree node to update.
+    static void updateHash(TreeNode* node);
+
+    // ----------------------------updateAncestors---------------------------------
+    // Description: The method updateAncestors recomputes the cached heights from
+    // the given tree node toward the root, stopping at the first node whose
+    // height does not change, since the nodes above it cannot change either.
+    //
+    // Pre: The heights of the children of the given node must be correct.
+    //
+    // Parameter: node, which is the first tree node to update; it may be a null
+    // pointer.
+    void updateAncestors(TreeNode* node);
+
+    // ------------------------------replaceChild----------------------------------
+    // Description: The method replaceChild makes the parent of the given node,
+    // or the root pointer if the given node is the root, point to another node.
+    //
+    // Parameter: node, which is the tree node to replace.
+    //
+    // Parameter: replacement, which is the tree node that takes its place.
+    void replaceChild(TreeNode* node, TreeNode* replacement);
+
+    // -------------------------------rotateLeft-----------------------------------
+    // Description: The method rotateLeft lifts the right child of the given node
+    // into its place and makes the given node its left child.
+    //
+    // Pre: The given node must have a right child.
+    //
+    // Post: The inorder sequence of this binary search tree does not change. The
+    // heights of the two nodes are updated.
+    //
+    // Parameter: node, which is the tree node to lower.
+    //
+    // Return: The tree node that took the place of the given node.
+    TreeNode* rotateLeft(TreeNode* node);
+
+    // -------------------------------rotateRight----------------------------------
+    // Description: The method rotateRight lifts the left child of the given node
+    // into its place and makes the given node its right child.
+    //
+    // Pre: The given node must have a left child.
+    //
+    // Post: The inorder sequence of this binary search tree does not change. The
+    // heights of the two nodes are updated.
+    //
+    // Parameter: node, which is the tree node to lower.
+    //
+    // Return: The tree node that took the place of the given node.
+    TreeNode* rotateRight(TreeNode* node);
+
+    // ------------------------------rebalanceAvl----------------------------------
+    // Description: The method rebalanceAvl walks from the given node toward the
+    // root, updating heights, and rotates at the first node whose subtrees
+    // differ in height by two. After an insert one single or double rotation is
+    // enough, because it restores the height the subtree had before.
+    //
+    // Parameter: node, which is the parent of the tree node just inserted.
+    void rebalanceAvl(TreeNode* node);
 
-    // -------------------------------emptyHelper----------------------------------
-    // Description: The method emptyHelper deletes the binary tree whose root node
-    // is the given tree node, freeing the memory that is dynamically allocated to
-    // the binary tree.
+    // ---------------------------rebalanceRedBlack--------------------------------
+    // Description: The method rebalanceRedBlack recolors and rotates until the
+    // given red node no longer has a red parent, and then colors the root black.
+    //
+    // Parameter: node, which is the red tree node just inserted.
     //
-    // Pre: The given tree node must be a node of this binary search tree (where
-    // this method is initially invoked) or a null pointer.
+    // Return: True if the root was red before this method colored it black,
+    // which makes the black height of the tree one larger; false otherwise.
+    bool rebalanceRedBlack(TreeNode* node);
+
+    // --------------------------------rebalanceJoin--------------------------------
+    // Description: The method rebalanceJoin walks from the given node to the
+    // root, updating every node and rotating wherever the subtrees differ in
+    // height by two. Unlike after an insert, a join can leave the subtree taller
+    // after a rotation, so the walk never stops early.
+    //
+    // Parameter: node, which is the first tree node to update.
+    void rebalanceJoin(TreeNode* node);
+
+    // --------------------------------blackHeightOf--------------------------------
+    // Description: The method blackHeightOf counts the black tree nodes on the
+    // path from the given node to its leftmost null link, which is the same for
+    // every path in a red-black tree.
     //
-    // Post: The binary tree whose root node is the given tree node is empty. The
-    // dynamically allocated memory is free.
+    // Parameter: node, which is the root node of the subtree.
     //
-    // Parameter: rootEmpty, which is the root node of the binary tree to delete
-    // within this recursive call.
-    void emptyHelper(TreeNode*& rootEmpty);
+    // Return: The black height; zero for a null pointer.
+    static int blackHeightOf(const TreeNode* node);
+
+    // ---------------------------------joinHelper----------------------------------
+    // Description: The method joinHelper builds one balanced tree from the given
+    // subtrees and the given tree node between them. A subtree that is much
+    // taller than the other gets the other hung from the node, in the place of a
+    // subtree of about the same height on its inner path; the AVL and red-black
+    // rules are then restored on the way back up. It takes time proportional to
+    // the difference of the heights, or of the black heights in the red-black
+    // mode.
+    //
+    // Pre: Every string of the lower subtree comes before the one in the given
+    // node and every string of the upper subtree after it. The subtrees are
+    // valid in the balance mode of this tree, except that their roots may be
+    // red.
+    //
+    // Post: The root of this tree points to the joined tree, whose root node has
+    // no parent.
+    //
+    // Parameter: lower, which is the root node of the lower subtree.
+    //
+    // Parameter: middle, which is the tree node to put between the subtrees.
+    //
+    // Parameter: upper, which is the root node of the upper subtree.
+    //
+    // Parameter: lowerBlack, which is the black height of the lower subtree; it
+    // is used only in the red-black mode.
+    //
+    // Parameter: upperBlack, which is the black height of the upper subtree; it
+    // is used only in the red-black mode.
+    //
+    // Return: The black height of the joined tree in the red-black mode.
+    int joinHelper(TreeNode* lower, TreeNode* middle, TreeNode* upper, int lowerBlack,
+                   int upperBlack);
+
+    // -------------------------------leftmost-------------------------------------
+    // Description: The method leftmost returns the first tree node in inorder
+    // of the subtree whose root node is the given node.
+    //
+    // Pre: The given node must not be a null pointer.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Parameter: depth, which is the depth of the given node and becomes the
+    // depth of the returned node.
+    //
+    // Return: The leftmost tree node of the subtree.
+    static TreeNode* leftmost(TreeNode* node, int& depth);
+
+    // -------------------------------rightmost------------------------------------
+    // Description: The method rightmost returns the last tree node in inorder
+    // of the subtree whose root node is the given node.
+    //
+    // Pre: The given node must not be a null pointer.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Parameter: depth, which is the depth of the given node and becomes the
+    // depth of the returned node.
+    //
+    // Return: The rightmost tree node of the subtree.
+    static TreeNode* rightmost(TreeNode* node, int& depth);
+
+    // -------------------------------successor------------------------------------
+    // Description: The method successor returns the tree node that follows the
+    // given node in inorder. It steps down to the leftmost node of the right
+    // subtree or climbs the parent pointers, so a whole traversal visits every
+    // edge twice and needs no stack.
+    //
+    // Pre: The given node must not be a null pointer.
+    //
+    // Parameter: node, which is the current tree node.
+    //
+    // Parameter: depth, which is the depth of the given node and becomes the
+    // depth of the returned node.
+    //
+    // Return: The next tree node in inorder; a null pointer after the last.
+    static TreeNode* successor(TreeNode* node, int& depth);
+
+    // ------------------------------predecessor-----------------------------------
+    // Description: The method predecessor returns the tree node that comes
+    // before the given node in inorder, in the same way as successor.
+    //
+    // Pre: The given node must not be a null pointer.
+    //
+    // Parameter: node, which is the current tree node.
+    //
+    // Parameter: depth, which is the depth of the given node and becomes the
+    // depth of the returned node.
+    //
+    // Return: The previous tree node in inorder; a null pointer before the
+    // first.
+    static TreeNode* predecessor(TreeNode* node, int& depth);
+
+    // ------------------------------nextPreorder----------------------------------
+    // Description: The method nextPreorder returns the tree node that follows
+    // the given node in preorder within the subtree whose root node is the
+    // given top node.
+    //
+    // Pre: The given node must be in the subtree of the given top node.
+    //
+    // Parameter: node, which is the current tree node.
+    //
+    // Parameter: top, which is the root node of the subtree to traverse.
+    //
+    // Parameter: depth, which is the depth of the given node and becomes the
+    // depth of the returned node.
+    //
+    // Return: The next tree node in preorder; a null pointer after the last
+    // node of the subtree.
+    static TreeNode* nextPreorder(TreeNode* node, const TreeNode* top, int& depth);
 
     // -------------------------------copyHelper---------------------------------
-    // Description: The method copyHelper copies another binary search tree to
-    // this binary search tree by using preorder traversal to add the nodes in
-    // another binary search tree, whose root node is the given tree node, to
-    // this binary search tree.
+    // Description: The method copyHelper copies the binary tree whose root node
+    // is the given tree node node by node, keeping its structure, heights and
+    // colors. It walks the tree to copy and the copy in step: it goes down to a
+    // child that has not been copied yet and otherwise climbs back through the
+    // parent pointers of both trees. It makes no comparisons, so the copy takes
+    // O(n) time whatever the shape of the tree.
+    //
+    // Pre: The given tree node must be a node of the binary search tree to copy
+    // or a null pointer.
+    //
+    // Post: The binary tree whose root node is the given tree node does not
+    // change.
     //
-    // Pre: The given tree node must be a node of the binary search tree to copy.
-    // Before this method is initially invoked, this binary search tree (where
-    // this method is initially invoked) must be empty.
+    // Parameter: rootCopy, which is the root node of the binary tree to copy.
     //
-    // Post: The nodes in the binary search tree whose root node is the given tree
-    // node is added to this binary search tree based on preorder traversal.
+    // Parameter: parentCopy, which is the tree node that the copy should hang
+    // from.
     //
-    // Parameter: rootCopy, which is the root node of the binary search tree to
-    // copy within this recursive call.
-    void copyHelper(TreeNode* rootCopy);
+    // Return: The root node of the copy; a null pointer if the given node is a
+    // null pointer.
+    TreeNode* copyHelper(const TreeNode* rootCopy, TreeNode* parentCopy);
 
     // ------------------------------compareHelper---------------------------------
     // Description: The method compareHelper checks whether the two binary trees,
     // whose root nodes are the given nodes, have the same data items and the same
-    // structure.
+    // structure. It walks both trees in preorder in step and stops at the first
+    // node whose data item or children differ.
     //
     // Pre: One given node must be a node of this binary search tree (where this
     // method is initially invoked); the other given node must be a node of a
@@ -265,21 +1199,53 @@ private:
     // Post: Both binary trees do not change.
     //
     // Parameter: rootThis, which is a node of this binary search tree and is the
-    // root node of a binary tree to check within this recursive call.
+    // root node of a binary tree to check.
     //
     // Parameter: rootOther, which is a node of a different binary tree and is
-    // the root node of another binary tree to check within this recursive call.
+    // the root node of another binary tree to check.
     //
     // Return: True if the two binary trees are the same; false otherwise.
     bool compareHelper(TreeNode* rootThis, TreeNode* rootOther) const;
 
+    // ------------------------------diffHelper------------------------------------
+    // Description: The method diffHelper adds the strings that are in only one
+    // of the two given subtrees, which hold the strings of the same key range, to
+    // the given lists.
+    //
+    // Parameter: nodeThis, which is the root node of the subtree of this tree.
+    //
+    // Parameter: nodeOther, which is the root node of the subtree of the other
+    // tree.
+    //
+    // Parameter: onlyThis, which collects the strings only in this tree.
+    //
+    // Parameter: onlyOther, which collects the strings only in the other tree.
+    void diffHelper(TreeNode* nodeThis, TreeNode* nodeOther, std::vector<const NodeData*>& onlyThis,
+                    std::vector<const NodeData*>& onlyOther) const;
+
+    // ------------------------------mergeHelper-----------------------------------
+    // Description: The method mergeHelper walks the two given subtrees in order
+    // side by side, as a merge does, and adds the strings that are in only one
+    // of them to the given lists.
+    //
+    // Parameter: nodeThis, which is the root node of the subtree of this tree.
+    //
+    // Parameter: nodeOther, which is the root node of the subtree of the other
+    // tree.
+    //
+    // Parameter: onlyThis, which collects the strings only in this tree.
+    //
+    // Parameter: onlyOther, which collects the strings only in the other tree.
+    void mergeHelper(TreeNode* nodeThis, TreeNode* nodeOther, std::vector<const NodeData*>& onlyThis,
+                     std::vector<const NodeData*>& onlyOther) const;
+
     // -------------------------------outputHelper---------------------------------
     // Description: The method outputHelper outputs the binary tree whose root
     // node is the given tree node through the given ostream object by using
     // inorder traversal.
     //
-    // Pre: The given tree node must be a node of this binary search tree (where
-    // this method is initially invoked).
+    // Pre: The given tree node must be the root node of this binary search tree
+    // (where this method is initially invoked) or a null pointer.
     //
     // Post: This method displays the binary tree whose root node is the given tree
     // node with inorder traversal. The binary tree does not change.
@@ -287,85 +1253,70 @@ private:
     // Parameter: output, which is the ostream object through which the binary
     // tree should be outputted.
     //
-    // Parameter: rootOutput, which is the root node of the binary tree to output
-    // within this recursive call.
+    // Parameter: rootOutput, which is the root node of the binary tree to output.
     void outputHelper(std::ostream& output, TreeNode* rootOutput) const;
 
     // ------------------------------retrieveHelper--------------------------------
-    // Description: The method retrieveHelper finds the given node data object in
-    // the binary search tree whose root node is the given node and set the given
-    // pointer to the address of the given object in the tree.
-    //
-    // Pre: The given node must be a node of this binary search tree.
-    //
-    // Post: The given pointer will point to the given node data object in the
-    // binary search tree if the given object is in the tree. The given pointer
-    // will point to garbage if the given object is not in the tree.
-    //
-    // Parameter: target, which is the object to retrieve.
+    // Description: The method retrieveHelper finds the tree node that contains
+    // the given string by descending from the root node.
     //
-    // Parameter: pointer, which will point to the given object if it is in the
-    // tree.
+    // Post: This binary search tree does not change.
     //
-    // Parameter: rootRetrieve, which is the root node of the binary search tree
-    // that this recursive call considers.
+    // Parameter: target, which is the string to find.
     //
-    // Return: True if this method found the given object, false otherwise.
-    bool retrieveHelper(const NodeData& target, NodeData*& pointer, TreeNode* rootRetrieve) const;
+    // Return: The tree node that contains the given string; a null pointer if
+    // the string is not in this binary search tree.
+    TreeNode* retrieveHelper(std::string_view target) const;
 
-    // -------------------------------heightHelper---------------------------------
-    // Description: The method heightHelper searches for the tree node that
-    // contains the given node data object within the binary tree whose root node
-    // is the given node and reports the height of the node that contains the
-    // object.
+    // ------------------------------rankHelper------------------------------------
+    // Description: The method rankHelper counts the node data objects in this
+    // binary search tree that come before the given string, and the one equal
+    // to it if asked to.
     //
-    // Pre: The given node data object should be in this binary search tree (where
-    // this method is initially invoked). The given tree node should be a node of
-    // this binary search tree.
+    // Parameter: target, which is the string to rank.
     //
-    // Post: The binary tree whose root node is the given tree node does not
-    // change.
+    // Parameter: inclusive, which is true to count a node data object equal to
+    // the given string.
     //
-    // Parameter: target, which is the node data object whose height should be
-    // reported.
+    // Return: The number of node data objects counted.
+    int rankHelper(std::string_view target, bool inclusive) const;
+
+    // ------------------------------boundHelper-----------------------------------
+    // Description: The method boundHelper finds the first tree node whose string
+    // does not come before the given string, or, if asked to, the first one whose
+    // string comes after it.
     //
-    // Parameter: rootGetHeight, which is the root node of the binary tree that
-    // this recursive call considers.
+    // Parameter: target, which is the string to search for.
     //
-    // Parameter: height, which is the cumulative height of the given node data
-    // object. If this is greater than zero, the tree node that contains the
-    // object is an ascendant of the binary tree whose root node is the given
-    // tree node.
+    // Parameter: after, which is true to skip a tree node equal to the string.
     //
-    // Return: The height of the given node data object; zero if the object does
-    // not exist in the binary tree whose root node is the given node.
-    int heightHelper(const NodeData& target, TreeNode* rootGetHeight, int height) const;
+    // Return: The tree node found; a null pointer if there is none.
+    TreeNode* boundHelper(std::string_view target, bool after) const;
 
     // -----------------------------sidewaysHelper---------------------------------
     // Description: The method sidewaysHelper displays the binary tree whose root
-    // node is the given tree node as if you are viewing it from the side.
+    // node is the given tree node as if you are viewing it from the side. It
+    // visits the nodes in reverse inorder and indents each one by its depth.
     //
-    // Pre: The given tree node should be a node of this binary search tree (where
-    // this method is initially invoked).
+    // Pre: The given tree node should be the root node of this binary search tree
+    // (where this method is initially invoked) or a null pointer.
     //
     // Post: The binary tree whose root node is the given tree node does not change.
     //
-    // Parameter: rootSideways, which is the root node of the binary tree that this
-    // recursive call considers.
-    //
-    // Parameter: level, which is an integer that determines the indentation.
-    void sidewaysHelper(TreeNode* rootSideways, int level) const;
+    // Parameter: rootSideways, which is the root node of the binary tree to
+    // display.
+    void sidewaysHelper(TreeNode* rootSideways) const;
 
     // ------------------------------toArrayHelper---------------------------------
     // Description: The method toArrayHelper adds the node data objects in the
     // binary search tree whose root node is the given tree node to the given
-    // array based on inorder traversal.
+    // array based on inorder traversal, and then empties the tree. A node data
+    // object stored in a tree node is copied to a dynamically allocated one.
     //
-    // Pre: The given array should be a statically allocated array whose size is
-    // 100. The number of tree nodes in the binary search tree whose root node is
+    // Pre: The number of tree nodes in the binary search tree whose root node is
     // the given node cannot be more than the remaining spaces in the array.
-    // Finally, the given tree node should be a node of this binary search tree
-    // (where this method is initially invoked).
+    // Finally, the given tree node should be the root node of this binary search
+    // tree (where this method is initially invoked).
     //
     // Post: The given array contains the node data objects in the binary search
     // tree whose root node is the given node, and the node data objects are
@@ -379,7 +1330,7 @@ private:
     // the node data objects to the array.
     //
     // Parameter: rootToArray, which is the root node of the binary search tree
-    // that this recursive call consider.
+    // to convert.
     void toArrayHelper(NodeData* dataArray[], int& index, TreeNode*& rootToArray);
 
     // ------------------------------toTreeHelper----------------------------------
@@ -392,7 +1343,9 @@ private:
     //
     // Post: The node data objects in the given array are replaced with null
     // pointers. The given pointer points to the root of a balanced binary search
-    // tree that contains the node data objects in the given array.
+    // tree that contains the node data objects in the given array. Every node
+    // has its parent and height set, and the nodes at the given red depth are
+    // red.
     //
     // Parameter: dataArray, which is the array that contains node data objects.
     //
@@ -404,5 +1357,246 @@ private:
     //
     // Parameter: rootToTree, which is the pointer that should point to the root
     // node of the created binary search tree.
-    void toTreeHelper(NodeData* dataArray[], int low, int high, TreeNode*& rootToTree);
-};
\ No newline at end of file
+    //
+    // Parameter: parentToTree, which is the tree node that the created tree
+    // hangs from.
+    //
+    // Parameter: depth, which is the depth of the root node of the created
+    // tree.
+    //
+    // Parameter: redDepth, which is the depth whose nodes should be red.
+    void toTreeHelper(NodeData* dataArray[], int low, int high, TreeNode*& rootToTree,
+                      TreeNode* parentToTree, int depth, int redDepth);
+
+    // ------------------------------buildHelper-----------------------------------
+    // Description: The method buildHelper checks that the first count node data
+    // objects in the given array are sorted and, if they are, builds this binary
+    // search tree from them.
+    //
+    // Pre: This binary search tree should be empty.
+    //
+    // Parameter: dataArray, which is the array that contains node data objects.
+    //
+    // Parameter: count, which is the number of node data objects to use.
+    //
+    // Return: True if this method built the tree, false otherwise.
+    bool buildHelper(NodeData* dataArray[], int count);
+
+    // -------------------------------makeVine-------------------------------------
+    // Description: The method makeVine rotates right at every node on the right
+    // spine that has a left child, until no node has one.
+    //
+    // Post: Every tree node is the right child of its inorder predecessor. The
+    // cached heights are not correct.
+    //
+    // Return: The number of tree nodes.
+    int makeVine();
+
+    // -------------------------------compress-------------------------------------
+    // Description: The method compress rotates left at the given number of
+    // nodes down the right spine, starting at the root and skipping one node
+    // after each rotation, which halves the length of the spine.
+    //
+    // Parameter: count, which is the number of rotations.
+    void compress(int count);
+
+    // ------------------------------refreshHelper---------------------------------
+    // Description: The method refreshHelper recomputes the cached height of
+    // every tree node, children before parents, and colors the nodes at the
+    // given depth red and the others black.
+    //
+    // Parameter: redDepth, which is the depth whose nodes should be red.
+    void refreshHelper(int redDepth);
+
+    // ------------------------------appendHelper----------------------------------
+    // Description: The method appendHelper adds the given string during
+    // buildFromSorted: as the right child of the tail if it comes after the
+    // tail, not at all if it equals the tail, and to the list of late strings if
+    // it comes before it. If this tree was not empty when the build started, it
+    // inserts the string instead.
+    //
+    // Parameter: key, which is the string to add.
+    //
+    // Parameter: tail, which is the last tree node added; a null pointer before
+    // the first one.
+    //
+    // Parameter: late, which holds the strings that came out of order.
+    void appendHelper(const std::string& key, TreeNode*& tail, std::vector<std::string>& late);
+
+    // ------------------------------finishHelper----------------------------------
+    // Description: The method finishHelper balances the chain that appendHelper
+    // built and inserts the strings that came out of order.
+    //
+    // Parameter: tail, which is the last tree node added; a null pointer if
+    // appendHelper added none.
+    //
+    // Parameter: late, which holds the strings that came out of order.
+    void finishHelper(TreeNode* tail, std::vector<std::string>& late);
+
+    // -----------------------------parallelHelper---------------------------------
+    // Description: The method parallelHelper builds the midpoint tree of the
+    // given sorted strings in the tree nodes made for them, copying each string
+    // into its tree node, in the same way as
+    // toTreeHelper. The string at position i goes to the tree node at position i,
+    // so two threads never touch the same tree node, and it hands the left
+    // subtree to a new thread while more than one thread is left.
+    //
+    // Parameter: keys, which point to the sorted strings without duplicates.
+    //
+    // Parameter: nodes, which are the tree nodes, one per string.
+    //
+    // Parameter: low, which is the lowest position that this call considers.
+    //
+    // Parameter: high, which is the highest position that this call considers.
+    //
+    // Parameter: parentToTree, which is the tree node that the created tree
+    // hangs from.
+    //
+    // Parameter: depth, which is the depth of the root node of the created
+    // tree.
+    //
+    // Parameter: redDepth, which is the depth whose nodes should be red.
+    //
+    // Parameter: threadCount, which is the number of threads for this subtree.
+    //
+    // Return: The root node of the created tree; a null pointer if the range is
+    // empty.
+    TreeNode* parallelHelper(const std::vector<const std::string*>& keys, TreeNode* nodes, int low,
+                             int high, TreeNode* parentToTree, int depth, int redDepth,
+                             unsigned threadCount);
+
+    // ---------------------------------linkHelper---------------------------------
+    // Description: The method linkHelper links the given tree nodes, which hold
+    // sorted strings, into their midpoint tree, in the same way as toTreeHelper.
+    //
+    // Parameter: nodes, which are the tree nodes.
+    //
+    // Parameter: low, which is the lowest position that this call considers.
+    //
+    // Parameter: high, which is the highest position that this call considers.
+    //
+    // Parameter: parentToTree, which is the tree node that the linked tree hangs
+    // from.
+    //
+    // Parameter: depth, which is the depth of the root node of the linked tree.
+    //
+    // Parameter: redDepth, which is the depth whose nodes should be red.
+    //
+    // Return: The root node of the linked tree; a null pointer if the range is
+    // empty.
+    TreeNode* linkHelper(TreeNode* nodes, int low, int high, TreeNode* parentToTree, int depth,
+                         int redDepth);
+
+    // --------------------------------combine-------------------------------------
+    // Description: The method combine replaces this binary search tree with the
+    // strings of this tree and the given tree that the given parts select. It
+    // merges the strings of both trees in order and builds a balanced tree from
+    // the result, so it takes O(n + m) time for trees of n and m strings and
+    // allocates the new tree nodes in one chunk. With more than one thread, the
+    // merge is split at the middle string of the larger tree, and the halves are
+    // merged and built at the same time. The old tree nodes are freed only after
+    // the new ones hold copies of their strings.
+    //
+    // Parameter: other, which is the binary search tree to combine with.
+    //
+    // Parameter: parts, which is the set of SetPart values to keep.
+    //
+    // Parameter: threadCount, the number of threads to use; zero uses one per
+    // core.
+    void combine(const BinTree& other, int parts, unsigned threadCount);
+
+    // -----------------------------combineHelper----------------------------------
+    // Description: The method combineHelper merges the given sorted ranges of
+    // tree nodes of this tree and of another tree, and adds the strings that the
+    // given parts select to the given list in order. With more than one thread,
+    // it splits both ranges at the middle string of the larger one, merges the
+    // lower halves in a new thread, and joins the two lists.
+    //
+    // Parameter: thisFirst, which is the first tree node of this tree.
+    //
+    // Parameter: thisLast, which is just after the last tree node of this tree.
+    //
+    // Parameter: otherFirst, which is the first tree node of the other tree.
+    //
+    // Parameter: otherLast, which is just after the last tree node of the other
+    // tree.
+    //
+    // Parameter: parts, which is the set of SetPart values to keep.
+    //
+    // Parameter: keys, to which the strings are added.
+    //
+    // Parameter: threadCount, which is the number of threads for the ranges.
+    void combineHelper(TreeNode* const* thisFirst, TreeNode* const* thisLast,
+                       TreeNode* const* otherFirst, TreeNode* const* otherLast, int parts,
+                       std::vector<const std::string*>& keys, unsigned threadCount) const;
+
+    // ------------------------------inorderNodes----------------------------------
+    // Description: The method inorderNodes lists the tree nodes of the given
+    // tree in the key order.
+    //
+    // Parameter: top, which is the root node of the tree.
+    //
+    // Parameter: nodes, which receives the tree nodes.
+    static void inorderNodes(TreeNode* top, std::vector<TreeNode*>& nodes);
+};
+
+// ----------------------------forEachInRange----------------------------------
+// Description: The method forEachInRange passes every node data object from
+// the given low one to the given high one, inclusive, to the given function
+// in the key order. It descends once and then walks the k objects in the
+// range, so it takes O(h + k) time and prints or allocates nothing.
+//
+// Post: This binary search tree does not change.
+//
+// Parameter: low, which is the smallest node data object to visit.
+//
+// Parameter: high, which is the largest node data object to visit.
+//
+// Parameter: visit, which is called as visit(data) with a constant
+// reference to each node data object.
+template <class Visit>
+void BinTree::forEachInRange(const NodeData& low, const NodeData& high, Visit visit) const
+{
+    // The walk stops at the first tree node that comes after the high object,
+    // whose summary is computed once.
+    std::string_view last = high.getData();
+    unsigned long long summary = order.summarize(last);
+    int depth = 0;
+    for (TreeNode* node = boundHelper(low.getData(), false);
+         node != nullptr && compareKey(last, summary, node) >= 0;
+         node = successor(node, depth))
+    {
+        visit(static_cast<const NodeData&>(*(node -> data)));
+    }
+} // end of the method forEachInRange
+
+// -----------------------------buildFromSorted--------------------------------
+// Description: The method buildFromSorted adds the strings in the given range,
+// which should be sorted in the key order of this tree, in O(n) time. It links
+// each new string as the right child of the one before, which needs no search
+// and no array, and then balances the chain in place with rebalance.
+//
+// Pre: The strings should be sorted in the key order of this tree.
+//
+// Post: This binary search tree contains the strings, each once, and is
+// balanced in the same way as after rebalance. A string that repeats the one
+// before it is skipped, as insert would. A string that comes before the one
+// before it is inserted after the build, so unsorted input gives a correct
+// tree but costs more time. If this tree is not empty, every string is
+// inserted.
+//
+// Parameter: first, the iterator at the first string.
+//
+// Parameter: last, the iterator just after the last string.
+template <class InputIterator>
+void BinTree::buildFromSorted(InputIterator first, InputIterator last)
+{
+    TreeNode* tail = nullptr;
+    std::vector<std::string> late;
+    for (; first != last; ++first)
+    {
+        const std::string& key = *first;
+        appendHelper(key, tail, late);
+    }
+    finishHelper(tail, late);
+} // end of the method buildFromSorted
\ No newline at end of file
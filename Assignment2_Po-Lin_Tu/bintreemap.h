@@ -0,0 +1,639 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <type_traits>
+
+// --------------------------------- bintreemap.h ---------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the BinTreeMap class template, a
+// binary search tree that maps keys of any type to values of any type. The
+// BinTreeMap class template keeps itself balanced as an AVL tree, allocates its
+// nodes in chunks, and finds a key with one comparison per level.
+//
+// Note: The default comparator, std::less<>, is transparent, so a map whose keys
+// are strings can be searched by a string view or a C string without building a
+// string. A map whose keys are integers and whose comparator is std::less picks
+// the child to visit by indexing with the result of the comparison instead of
+// branching on it. The BinTree class stays the tree of node data objects that
+// the assignment asks for; this template is for other keys and values.
+// --------------------------------------------------------------------------------
+
+// Whether a comparator declares is_transparent, that is, accepts keys of other
+// types than the key type as they are.
+template <class Compare, class = void>
+struct BinTreeMapTransparent : std::false_type
+{
+};
+
+template <class Compare>
+struct BinTreeMapTransparent<Compare, std::void_t<typename Compare::is_transparent>> : std::true_type
+{
+};
+
+template <class Key, class Value, class Compare = std::less<>>
+class BinTreeMap
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates an empty map.
+    //
+    // Post: An empty map exists.
+    //
+    // Parameter: compare, which is the comparator that orders the keys.
+    explicit BinTreeMap(const Compare& compare = Compare());
+
+    // ------------------------------Copy Constructor------------------------------
+    // Description: The copy constructor creates a map with the same keys and
+    // values as the given one.
+    //
+    // Post: A new map that contains the same entries as the given map exists.
+    //
+    // Parameter: other, which is the map to copy.
+    BinTreeMap(const BinTreeMap& other);
+
+    // ------------------------------operator = -----------------------------------
+    // Description: The method operator= replaces the entries of this map with
+    // the entries of the map on the right-hand side.
+    //
+    // Post: This map contains the same entries as the map on the right-hand side.
+    //
+    // Parameter: rhs, the map to assign to this one.
+    //
+    // Return: A reference to this map.
+    BinTreeMap& operator=(const BinTreeMap& rhs);
+
+    // -------------------------------isEmpty--------------------------------------
+    // Description: The method isEmpty reports whether this map is empty.
+    //
+    // Return: True if this map has no entries; false otherwise.
+    bool isEmpty() const;
+
+    // ---------------------------------size---------------------------------------
+    // Description: The method size reports the number of entries in this map.
+    //
+    // Return: The number of entries.
+    size_t size() const;
+
+    // -------------------------------makeEmpty------------------------------------
+    // Description: The method makeEmpty removes every entry and frees the chunks
+    // of nodes at once.
+    //
+    // Post: This map is empty.
+    void makeEmpty();
+
+    // ---------------------------------insert-------------------------------------
+    // Description: The method insert adds the given key with the given value.
+    // The AVL tree is rebalanced on the way back up.
+    //
+    // Post: The key maps to the value if the key was not in this map. If the key
+    // was already in this map, this method does nothing.
+    //
+    // Parameter: key, which is the key to add.
+    //
+    // Parameter: value, which is the value of the key.
+    //
+    // Return: True if this method added the key; false if this method did
+    // nothing.
+    bool insert(const Key& key, const Value& value);
+
+    // ------------------------------operator [] ----------------------------------
+    // Description: The method operator[] returns the value of the given key,
+    // adding the key with a default value if it is not in this map.
+    //
+    // Parameter: key, which is the key to look up.
+    //
+    // Return: A reference to the value of the key.
+    Value& operator[](const Key& key);
+
+    // ---------------------------------find---------------------------------------
+    // Description: The method find returns the value of the given key. With a
+    // transparent comparator, the key may be of any type that the comparator
+    // accepts, and nothing is converted to the key type. Otherwise the key is
+    // converted once, before the search.
+    //
+    // Parameter: key, which is the key to look up.
+    //
+    // Return: A pointer to the value; a null pointer if the key is not in this
+    // map.
+    template <class Lookup>
+    Value* find(const Lookup& key);
+
+    template <class Lookup>
+    const Value* find(const Lookup& key) const;
+
+    // -------------------------------contains-------------------------------------
+    // Description: The method contains reports whether the given key is in this
+    // map, in the same way as find.
+    //
+    // Parameter: key, which is the key to look up.
+    //
+    // Return: True if the key is in this map; false otherwise.
+    template <class Lookup>
+    bool contains(const Lookup& key) const;
+
+    // -------------------------------forEach--------------------------------------
+    // Description: The method forEach passes every key and its value to the
+    // given function in the order of the keys.
+    //
+    // Parameter: visit, which is called as visit(key, value).
+    template <class Visit>
+    void forEach(Visit visit) const;
+
+    // -------------------------------getHeight------------------------------------
+    // Description: The method getHeight reports the height of this map's tree.
+    //
+    // Return: The height; zero for an empty map.
+    int getHeight() const;
+
+private:
+    struct Node
+    {
+        Key key;
+        Value value;
+        Node* child[2];
+        Node* parent;
+        int height;
+    };
+
+    // Whether keys are integers compared with std::less, in which case a
+    // comparison is a plain < that the search uses as an index.
+    static const bool INTEGER_KEYS = std::is_integral<Key>::value &&
+        (std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<Key>>::value);
+
+    Node* root;
+    Compare compare;
+
+    // The nodes, in the order they were added. A deque never moves an element,
+    // so it hands out nodes in chunks like a node pool.
+    std::deque<Node> nodes;
+
+    // --------------------------------before--------------------------------------
+    // Description: The method before reports whether the first key comes before
+    // the second one.
+    //
+    // Return: True if the first key comes first; false otherwise.
+    template <class Lhs, class Rhs>
+    bool before(const Lhs& lhs, const Rhs& rhs) const;
+
+    // ------------------------------lowerBound------------------------------------
+    // Description: The method lowerBound finds the first node whose key does not
+    // come before the given key. The search makes one comparison per level.
+    //
+    // Parameter: key, which is the key to look up.
+    //
+    // Parameter: parent, which becomes the last node on the search path; a null
+    // pointer for an empty map.
+    //
+    // Parameter: side, which becomes the child of the parent where the key
+    // would be added.
+    //
+    // Return: The first node that does not come before the key; a null pointer
+    // if there is none.
+    template <class Lookup>
+    Node* lowerBound(const Lookup& key, Node*& parent, int& side) const;
+
+    // -------------------------------findNode-------------------------------------
+    // Description: The method findNode returns the node whose key equals the
+    // given key.
+    //
+    // Parameter: key, which is the key to look up.
+    //
+    // Return: The node; a null pointer if the key is not in this map.
+    template <class Lookup>
+    Node* findNode(const Lookup& key) const;
+
+    // --------------------------------addNode-------------------------------------
+    // Description: The method addNode adds a node with the given key and value
+    // as the given child of the given parent and rebalances the tree.
+    //
+    // Return: The new node.
+    Node* addNode(const Key& key, const Value& value, Node* parent, int side);
+
+    // --------------------------------heightOf------------------------------------
+    // Description: The method heightOf returns the height of a subtree.
+    //
+    // Return: The height; zero for a null pointer.
+    static int heightOf(const Node* node);
+
+    // ---------------------------------rotate-------------------------------------
+    // Description: The method rotate raises the given child of the given node
+    // into its place and updates both heights.
+    //
+    // Parameter: node, which is the node to lower.
+    //
+    // Parameter: side, which is the child to raise: 0 for left, 1 for right.
+    //
+    // Return: The raised node.
+    Node* rotate(Node* node, int side);
+};
+
+// ----------------------------------------------------------------------------
+// The definitions of the member templates follow.
+// ----------------------------------------------------------------------------
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an empty map.
+//
+// Post: An empty map exists.
+//
+// Parameter: compare, which is the comparator that orders the keys.
+template <class Key, class Value, class Compare>
+BinTreeMap<Key, Value, Compare>::BinTreeMap(const Compare& compare) :
+root(nullptr), compare(compare)
+{
+
+} // end of the default constructor
+
+// ------------------------------Copy Constructor------------------------------
+// Description: The copy constructor creates a map with the same keys and
+// values as the given one.
+//
+// Post: A new map that contains the same entries as the given map exists.
+//
+// Parameter: other, which is the map to copy.
+template <class Key, class Value, class Compare>
+BinTreeMap<Key, Value, Compare>::BinTreeMap(const BinTreeMap& other) :
+root(nullptr), compare(other.compare)
+{
+    operator=(other);
+} // end of the copy constructor
+
+// ------------------------------operator = -----------------------------------
+// Description: The method operator= replaces the entries of this map with
+// the entries of the map on the right-hand side.
+//
+// Post: This map contains the same entries as the map on the right-hand side.
+//
+// Parameter: rhs, the map to assign to this one.
+//
+// Return: A reference to this map.
+template <class Key, class Value, class Compare>
+BinTreeMap<Key, Value, Compare>& BinTreeMap<Key, Value, Compare>::operator=(const BinTreeMap& rhs)
+{
+    if (this != &rhs)
+    {
+        makeEmpty();
+        compare = rhs.compare;
+
+        // The keys come in increasing order, so each one is added as the last
+        // node on the right spine of the tree.
+        rhs.forEach([this](const Key& key, const Value& value)
+        {
+            Node* parent = root;
+            while (parent != nullptr && parent -> child[1] != nullptr)
+            {
+                parent = parent -> child[1];
+            }
+            addNode(key, value, parent, 1);
+        });
+    }
+    return *this;
+} // end of the method operator =
+
+// -------------------------------isEmpty--------------------------------------
+// Description: The method isEmpty reports whether this map is empty.
+//
+// Return: True if this map has no entries; false otherwise.
+template <class Key, class Value, class Compare>
+bool BinTreeMap<Key, Value, Compare>::isEmpty() const
+{
+    return root == nullptr;
+} // end of the method isEmpty
+
+// ---------------------------------size---------------------------------------
+// Description: The method size reports the number of entries in this map.
+//
+// Return: The number of entries.
+template <class Key, class Value, class Compare>
+size_t BinTreeMap<Key, Value, Compare>::size() const
+{
+    return nodes.size();
+} // end of the method size
+
+// -------------------------------makeEmpty------------------------------------
+// Description: The method makeEmpty removes every entry and frees the chunks
+// of nodes at once.
+//
+// Post: This map is empty.
+template <class Key, class Value, class Compare>
+void BinTreeMap<Key, Value, Compare>::makeEmpty()
+{
+    root = nullptr;
+    nodes.clear();
+} // end of the method makeEmpty
+
+// ---------------------------------insert-------------------------------------
+// Description: The method insert adds the given key with the given value.
+// The AVL tree is rebalanced on the way back up.
+//
+// Post: The key maps to the value if the key was not in this map. If the key
+// was already in this map, this method does nothing.
+//
+// Parameter: key, which is the key to add.
+//
+// Parameter: value, which is the value of the key.
+//
+// Return: True if this method added the key; false if this method did
+// nothing.
+template <class Key, class Value, class Compare>
+bool BinTreeMap<Key, Value, Compare>::insert(const Key& key, const Value& value)
+{
+    Node* parent = nullptr;
+    int side = 0;
+    Node* bound = lowerBound(key, parent, side);
+    if (bound != nullptr && !before(key, bound -> key))
+    {
+        return false;
+    }
+    addNode(key, value, parent, side);
+    return true;
+} // end of the method insert
+
+// ------------------------------operator [] ----------------------------------
+// Description: The method operator[] returns the value of the given key,
+// adding the key with a default value if it is not in this map.
+//
+// Parameter: key, which is the key to look up.
+//
+// Return: A reference to the value of the key.
+template <class Key, class Value, class Compare>
+Value& BinTreeMap<Key, Value, Compare>::operator[](const Key& key)
+{
+    Node* parent = nullptr;
+    int side = 0;
+    Node* bound = lowerBound(key, parent, side);
+    if (bound != nullptr && !before(key, bound -> key))
+    {
+        return bound -> value;
+    }
+    return addNode(key, Value(), parent, side) -> value;
+} // end of the method operator []
+
+// ---------------------------------find---------------------------------------
+// Description: The method find returns the value of the given key. With a
+// transparent comparator, the key may be of any type that the comparator
+// accepts, and nothing is converted to the key type. Otherwise the key is
+// converted once, before the search.
+//
+// Parameter: key, which is the key to look up.
+//
+// Return: A pointer to the value; a null pointer if the key is not in this
+// map.
+template <class Key, class Value, class Compare>
+template <class Lookup>
+Value* BinTreeMap<Key, Value, Compare>::find(const Lookup& key)
+{
+    Node* node = findNode(key);
+    return (node != nullptr) ? &(node -> value) : nullptr;
+} // end of the method find
+
+template <class Key, class Value, class Compare>
+template <class Lookup>
+const Value* BinTreeMap<Key, Value, Compare>::find(const Lookup& key) const
+{
+    const Node* node = findNode(key);
+    return (node != nullptr) ? &(node -> value) : nullptr;
+} // end of the method find
+
+// -------------------------------contains-------------------------------------
+// Description: The method contains reports whether the given key is in this
+// map, in the same way as find.
+//
+// Parameter: key, which is the key to look up.
+//
+// Return: True if the key is in this map; false otherwise.
+template <class Key, class Value, class Compare>
+template <class Lookup>
+bool BinTreeMap<Key, Value, Compare>::contains(const Lookup& key) const
+{
+    return findNode(key) != nullptr;
+} // end of the method contains
+
+// -------------------------------forEach--------------------------------------
+// Description: The method forEach passes every key and its value to the
+// given function in the order of the keys.
+//
+// Parameter: visit, which is called as visit(key, value).
+template <class Key, class Value, class Compare>
+template <class Visit>
+void BinTreeMap<Key, Value, Compare>::forEach(Visit visit) const
+{
+    // Walk inorder through the parent pointers, without a stack.
+    const Node* node = root;
+    while (node != nullptr && node -> child[0] != nullptr)
+    {
+        node = node -> child[0];
+    }
+    while (node != nullptr)
+    {
+        visit(node -> key, node -> value);
+        if (node -> child[1] != nullptr)
+        {
+            node = node -> child[1];
+            while (node -> child[0] != nullptr)
+            {
+                node = node -> child[0];
+            }
+        }
+        else
+        {
+            while (node -> parent != nullptr && node == node -> parent -> child[1])
+            {
+                node = node -> parent;
+            }
+            node = node -> parent;
+        }
+    }
+} // end of the method forEach
+
+// -------------------------------getHeight------------------------------------
+// Description: The method getHeight reports the height of this map's tree.
+//
+// Return: The height; zero for an empty map.
+template <class Key, class Value, class Compare>
+int BinTreeMap<Key, Value, Compare>::getHeight() const
+{
+    return heightOf(root);
+} // end of the method getHeight
+
+// --------------------------------before--------------------------------------
+// Description: The method before reports whether the first key comes before
+// the second one.
+//
+// Return: True if the first key comes first; false otherwise.
+template <class Key, class Value, class Compare>
+template <class Lhs, class Rhs>
+bool BinTreeMap<Key, Value, Compare>::before(const Lhs& lhs, const Rhs& rhs) const
+{
+    if constexpr (INTEGER_KEYS)
+    {
+        return lhs < rhs;
+    }
+    else
+    {
+        return compare(lhs, rhs);
+    }
+} // end of the method before
+
+// ------------------------------lowerBound------------------------------------
+// Description: The method lowerBound finds the first node whose key does not
+// come before the given key. The search makes one comparison per level.
+//
+// Parameter: key, which is the key to look up.
+//
+// Parameter: parent, which becomes the last node on the search path; a null
+// pointer for an empty map.
+//
+// Parameter: side, which becomes the child of the parent where the key
+// would be added.
+//
+// Return: The first node that does not come before the key; a null pointer
+// if there is none.
+template <class Key, class Value, class Compare>
+template <class Lookup>
+typename BinTreeMap<Key, Value, Compare>::Node*
+BinTreeMap<Key, Value, Compare>::lowerBound(const Lookup& key, Node*& parent, int& side) const
+{
+    Node* bound = nullptr;
+    Node* node = root;
+    parent = nullptr;
+    side = 0;
+    while (node != nullptr)
+    {
+        // Go right past a key that comes before the given one; otherwise the
+        // node is the best bound so far and the search goes left. With integer
+        // keys the comparison is only an index, so there is nothing to predict.
+        parent = node;
+        side = before(node -> key, key);
+        bound = side ? bound : node;
+        node = node -> child[side];
+    }
+    return bound;
+} // end of the method lowerBound
+
+// -------------------------------findNode-------------------------------------
+// Description: The method findNode returns the node whose key equals the
+// given key.
+//
+// Parameter: key, which is the key to look up.
+//
+// Return: The node; a null pointer if the key is not in this map.
+template <class Key, class Value, class Compare>
+template <class Lookup>
+typename BinTreeMap<Key, Value, Compare>::Node*
+BinTreeMap<Key, Value, Compare>::findNode(const Lookup& key) const
+{
+    // A comparator that only takes the key type would convert the key at every
+    // level, so convert it once here.
+    if constexpr (!BinTreeMapTransparent<Compare>::value && !std::is_same<Lookup, Key>::value)
+    {
+        return findNode(static_cast<const Key&>(Key(key)));
+    }
+    else
+    {
+        Node* parent = nullptr;
+        int side = 0;
+        Node* bound = lowerBound(key, parent, side);
+        return (bound != nullptr && !before(key, bound -> key)) ? bound : nullptr;
+    }
+} // end of the method findNode
+
+// --------------------------------addNode-------------------------------------
+// Description: The method addNode adds a node with the given key and value
+// as the given child of the given parent and rebalances the tree.
+//
+// Return: The new node.
+template <class Key, class Value, class Compare>
+typename BinTreeMap<Key, Value, Compare>::Node*
+BinTreeMap<Key, Value, Compare>::addNode(const Key& key, const Value& value, Node* parent, int side)
+{
+    nodes.push_back(Node{key, value, {nullptr, nullptr}, parent, 1});
+    Node* newNode = &nodes.back();
+    if (parent == nullptr)
+    {
+        root = newNode;
+        return newNode;
+    }
+    parent -> child[side] = newNode;
+
+    // Climb until a height stops changing; one single or double rotation
+    // restores the balance after an insert.
+    for (Node* node = parent; node != nullptr; node = node -> parent)
+    {
+        int previousHeight = node -> height;
+        int balance = heightOf(node -> child[1]) - heightOf(node -> child[0]);
+        if (balance > 1 || balance < -1)
+        {
+            int tall = (balance > 0) ? 1 : 0;
+            Node* child = node -> child[tall];
+            if (heightOf(child -> child[1 - tall]) > heightOf(child -> child[tall]))
+            {
+                rotate(child, 1 - tall);
+            }
+            rotate(node, tall);
+            break;
+        }
+
+        node -> height = 1 + std::max(heightOf(node -> child[0]), heightOf(node -> child[1]));
+        if (node -> height == previousHeight)
+        {
+            break;
+        }
+    }
+    return newNode;
+} // end of the method addNode
+
+// --------------------------------heightOf------------------------------------
+// Description: The method heightOf returns the height of a subtree.
+//
+// Return: The height; zero for a null pointer.
+template <class Key, class Value, class Compare>
+int BinTreeMap<Key, Value, Compare>::heightOf(const Node* node)
+{
+    return (node != nullptr) ? node -> height : 0;
+} // end of the method heightOf
+
+// ---------------------------------rotate-------------------------------------
+// Description: The method rotate raises the given child of the given node
+// into its place and updates both heights.
+//
+// Parameter: node, which is the node to lower.
+//
+// Parameter: side, which is the child to raise: 0 for left, 1 for right.
+//
+// Return: The raised node.
+template <class Key, class Value, class Compare>
+typename BinTreeMap<Key, Value, Compare>::Node*
+BinTreeMap<Key, Value, Compare>::rotate(Node* node, int side)
+{
+    Node* raised = node -> child[side];
+    Node* inner = raised -> child[1 - side];
+
+    node -> child[side] = inner;
+    if (inner != nullptr)
+    {
+        inner -> parent = node;
+    }
+
+    raised -> parent = node -> parent;
+    if (node -> parent == nullptr)
+    {
+        root = raised;
+    }
+    else
+    {
+        node -> parent -> child[node == node -> parent -> child[1]] = raised;
+    }
+    raised -> child[1 - side] = node;
+    node -> parent = raised;
+
+    node -> height = 1 + std::max(heightOf(node -> child[0]), heightOf(node -> child[1]));
+    raised -> height = 1 + std::max(heightOf(raised -> child[0]), heightOf(raised -> child[1]));
+    return raised;
+} // end of the method rotate
\ No newline at end of file
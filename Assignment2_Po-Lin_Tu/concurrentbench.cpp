@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bintree.h"
+#include "concurrentbintree.h"
+using namespace std;
+
+// ---------------------------- concurrentbench.cpp ----------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file stress tests and benchmarks the ConcurrentBinTree class.
+// The stress test has one writer insert every key while reader threads look
+// up keys that the writer has already announced, which must be found, and
+// keys that are never inserted, which must not be. The benchmark runs reader
+// threads against one writer for a fixed time, once on a ConcurrentBinTree
+// and once on a red-black BinTree behind one mutex, and reports lookups and
+// inserts per second. The whole run is written to standard output as one
+// JSON object.
+//
+// Usage: g++ -std=c++17 -O2 -pthread concurrentbench.cpp concurrentbintree.cpp
+//            bintree.cpp nodedata.cpp treenode.cpp nodepool.cpp treeformat.cpp
+//            staticindex.cpp -o concurrentbench
+//        concurrentbench [reader threads] [keys] [seconds] > results.json
+// ----------------------------------------------------------------------------
+
+// ---------------------------------makeKeys-----------------------------------
+// Description: The function makeKeys returns the given number of distinct
+// keys with the given prefix in a random order.
+//
+// Parameter: prefix, which starts every key.
+//
+// Parameter: count, which is the number of keys.
+//
+// Parameter: random, which shuffles the keys.
+//
+// Return: The keys.
+static vector<string> makeKeys(const string& prefix, int count, mt19937& random)
+{
+    vector<string> keys;
+    keys.reserve(count);
+    for (int index = 0; index < count; index++)
+    {
+        keys.push_back(prefix + to_string(index));
+    }
+    shuffle(keys.begin(), keys.end(), random);
+    return keys;
+} // end of the function makeKeys
+
+// ---------------------------------stress-------------------------------------
+// Description: The function stress inserts every key from one thread while
+// the reader threads check the keys announced so far, and writes the counts
+// of checks and failures.
+//
+// Parameter: readerCount, which is the number of reader threads.
+//
+// Parameter: keys, which are the keys to insert.
+//
+// Parameter: absent, which are keys that are never inserted.
+static void stress(int readerCount, const vector<string>& keys, const vector<string>& absent)
+{
+    ConcurrentBinTree tree;
+    atomic<int> announced(0);
+    atomic<bool> done(false);
+    atomic<long long> checks(0);
+    atomic<long long> failures(0);
+
+    vector<thread> readers;
+    for (int reader = 0; reader < readerCount; reader++)
+    {
+        readers.emplace_back([&, reader]()
+        {
+            mt19937 random(reader + 1);
+            long long localChecks = 0;
+            long long localFailures = 0;
+            while (!done.load(memory_order_acquire))
+            {
+                int limit = announced.load(memory_order_acquire);
+                const NodeData* found = nullptr;
+                if (limit > 0)
+                {
+                    const string& key = keys[random() % limit];
+                    if (!tree.retrieve(key, found) || found -> getData() != key)
+                    {
+                        localFailures++;
+                    }
+                }
+                if (tree.retrieve(absent[random() % absent.size()], found))
+                {
+                    localFailures++;
+                }
+                localChecks += 2;
+            }
+            checks += localChecks;
+            failures += localFailures;
+        });
+    }
+
+    for (size_t index = 0; index < keys.size(); index++)
+    {
+        if (!tree.insert(keys[index]))
+        {
+            failures++;
+        }
+        announced.store(static_cast<int>(index + 1), memory_order_release);
+    }
+    done.store(true, memory_order_release);
+    for (size_t index = 0; index < readers.size(); index++)
+    {
+        readers[index].join();
+    }
+
+    // Every key must be there once the writer is done.
+    for (size_t index = 0; index < keys.size(); index++)
+    {
+        const NodeData* found = nullptr;
+        if (!tree.retrieve(keys[index], found))
+        {
+            failures++;
+        }
+    }
+    if (tree.getSize() != static_cast<int>(keys.size()))
+    {
+        failures++;
+    }
+
+    cout << "  \"stress\": {\"readers\": " << readerCount << ", \"keys\": " << keys.size()
+         << ", \"height\": " << tree.getHeight() << ", \"checks\": " << checks.load()
+         << ", \"failures\": " << failures.load() << "},\n";
+} // end of the function stress
+
+// ---------------------------------measure------------------------------------
+// Description: The function measure runs the reader threads and one writer
+// for the given time and writes the lookups and inserts per second.
+//
+// Parameter: name, which names the case in the output.
+//
+// Parameter: readerCount, which is the number of reader threads.
+//
+// Parameter: seconds, which is how long the case runs.
+//
+// Parameter: lookup, which is called as lookup(random) by the readers.
+//
+// Parameter: insert, which is called as insert(index) by the writer and
+// returns false once it has nothing left to insert.
+template <class Lookup, class Insert>
+static void measure(const string& name, int readerCount, double seconds, Lookup lookup,
+                    Insert insert)
+{
+    atomic<bool> done(false);
+    atomic<long long> lookups(0);
+    vector<thread> readers;
+    for (int reader = 0; reader < readerCount; reader++)
+    {
+        readers.emplace_back([&, reader]()
+        {
+            mt19937 random(reader + 101);
+            long long count = 0;
+            while (!done.load(memory_order_relaxed))
+            {
+                lookup(random);
+                count++;
+            }
+            lookups += count;
+        });
+    }
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    chrono::duration<double> limit(seconds);
+    long long inserts = 0;
+    while (chrono::steady_clock::now() - start < limit)
+    {
+        if (insert(inserts))
+        {
+            inserts++;
+        }
+        else
+        {
+            this_thread::yield();
+        }
+    }
+    done.store(true);
+    for (size_t index = 0; index < readers.size(); index++)
+    {
+        readers[index].join();
+    }
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << "    {\"tree\": \"" << name << "\", \"readers\": " << readerCount
+         << ", \"seconds\": " << elapsed << ", \"lookups_per_second\": " << lookups.load() / elapsed
+         << ", \"inserts_per_second\": " << inserts / elapsed << "}";
+} // end of the function measure
+
+int main(int argc, char* argv[])
+{
+    int readerCount = 4;
+    int keyCount = 1000000;
+    double seconds = 2.0;
+    if (argc > 1)
+    {
+        readerCount = atoi(argv[1]);
+    }
+    if (argc > 2)
+    {
+        keyCount = atoi(argv[2]);
+    }
+    if (argc > 3)
+    {
+        seconds = atof(argv[3]);
+    }
+
+    mt19937 random(343);
+    vector<string> keys = makeKeys("key", keyCount, random);
+    vector<string> absent = makeKeys("absent", 1024, random);
+
+    cout << "{\n  \"hardware_threads\": " << thread::hardware_concurrency() << ",\n";
+    stress(readerCount, keys, absent);
+
+    // Both trees start with the first half of the keys; the writer inserts
+    // the second half while the readers look up the first.
+    int prefilled = keyCount / 2;
+    cout << "  \"throughput\": [\n";
+
+    ConcurrentBinTree concurrent;
+    for (int index = 0; index < prefilled; index++)
+    {
+        concurrent.insert(keys[index]);
+    }
+    measure("ConcurrentBinTree", readerCount, seconds,
+            [&](mt19937& generator)
+            {
+                const NodeData* found = nullptr;
+                concurrent.retrieve(keys[generator() % prefilled], found);
+            },
+            [&](long long index)
+            {
+                return prefilled + index < keyCount && concurrent.insert(keys[prefilled + index]);
+            });
+    cout << ",\n";
+
+    BinTree locked(BinTree::RED_BLACK);
+    mutex lock;
+    for (int index = 0; index < prefilled; index++)
+    {
+        locked.insert(keys[index]);
+    }
+    measure("BinTree with mutex", readerCount, seconds,
+            [&](mt19937& generator)
+            {
+                NodeData* found = nullptr;
+                lock_guard<mutex> guard(lock);
+                locked.retrieve(keys[generator() % prefilled], found);
+            },
+            [&](long long index)
+            {
+                if (prefilled + index >= keyCount)
+                {
+                    return false;
+                }
+                lock_guard<mutex> guard(lock);
+                return locked.insert(keys[prefilled + index]);
+            });
+
+    cout << "\n  ]\n}" << endl;
+    return 0;
+}
\ No newline at end of file
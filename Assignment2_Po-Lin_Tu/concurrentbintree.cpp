@@ -0,0 +1,387 @@
+#include <thread>
+#include "concurrentbintree.h"
+
+// --------------------------- concurrentbintree.cpp ---------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the ConcurrentBinTree
+// class, a binary search tree of strings that threads search without locks
+// while one thread at a time inserts.
+// ----------------------------------------------------------------------------
+
+// The next reader slot to hand out. Threads take slots in turn, so up to
+// SLOT_COUNT threads each count in a slot of their own.
+static std::atomic<unsigned> nextSlot(0);
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an empty tree whose keys are
+// sorted in the given order.
+//
+// Post: An empty tree exists.
+//
+// Parameter: order, which is the order of the keys in this tree.
+ConcurrentBinTree::ConcurrentBinTree(const BinTree::KeyOrder& order) :
+root(nullptr), order(order), size(0), epoch(0)
+{
+    for (int index = 0; index < SLOT_COUNT; index++)
+    {
+        slots[index].readers[0].store(0);
+        slots[index].readers[1].store(0);
+    }
+} // end of the default constructor
+
+// ------------------------------Destructor------------------------------------
+// Description: The destructor frees every tree node and node data object.
+//
+// Pre: No other thread is using this tree.
+//
+// Post: This tree does not exist, and its memory is free.
+ConcurrentBinTree::~ConcurrentBinTree()
+{
+    // The retired nodes share their node data objects with the live tree, so
+    // only the live tree frees them.
+    for (size_t index = 0; index < retired.size(); index++)
+    {
+        delete retired[index];
+    }
+
+    std::vector<Node*> pending;
+    if (root.load() != nullptr)
+    {
+        pending.push_back(root.load());
+    }
+    while (!pending.empty())
+    {
+        Node* node = pending.back();
+        pending.pop_back();
+        if (node -> left.load() != nullptr)
+        {
+            pending.push_back(node -> left.load());
+        }
+        if (node -> right.load() != nullptr)
+        {
+            pending.push_back(node -> right.load());
+        }
+        delete node -> data;
+        delete node;
+    }
+} // end of the destructor
+
+// --------------------------------insert--------------------------------------
+// Description: The method insert adds a node data object with the given
+// string to this tree and rebalances it. Threads that insert at the same
+// time take turns; threads that search are never blocked, but the insert
+// that fills a batch of retired nodes waits for the searches that started
+// before it to finish.
+//
+// Post: The string is in this tree. Searches that start after this method
+// returns find it.
+//
+// Parameter: value, the string to insert.
+//
+// Return: True if this method added the string; false if it was already in
+// this tree.
+bool ConcurrentBinTree::insert(const std::string& value)
+{
+    std::lock_guard<std::mutex> guard(writerLock);
+
+    // Only the writer changes the links, so it reads them without ordering.
+    unsigned long long summary = order.summarize(value);
+    Node* path[MAX_HEIGHT];
+    int depth = 0;
+    std::atomic<Node*>* link = &root;
+    Node* current = root.load(std::memory_order_relaxed);
+    while (current != nullptr)
+    {
+        int comparison = compareKey(value, summary, current);
+        if (comparison == 0)
+        {
+            return false;
+        }
+        path[depth++] = current;
+        link = (comparison < 0) ? &(current -> left) : &(current -> right);
+        current = link -> load(std::memory_order_relaxed);
+    }
+
+    // The release store publishes the filled-in leaf to the searches.
+    Node* leaf = new Node;
+    leaf -> summary = summary;
+    leaf -> data = new NodeData(value);
+    leaf -> left.store(nullptr, std::memory_order_relaxed);
+    leaf -> right.store(nullptr, std::memory_order_relaxed);
+    leaf -> height = 1;
+    link -> store(leaf, std::memory_order_release);
+    size.fetch_add(1, std::memory_order_relaxed);
+
+    // Walk back up as the AVL insert does; one rotation restores the height
+    // the subtree had, so nothing above it changes.
+    for (int index = depth - 1; index >= 0; index--)
+    {
+        Node* node = path[index];
+        int previousHeight = node -> height;
+        update(node);
+        int balance = heightOf(node -> left.load(std::memory_order_relaxed)) -
+                      heightOf(node -> right.load(std::memory_order_relaxed));
+        if (balance > 1 || balance < -1)
+        {
+            std::atomic<Node*>* parentLink = &root;
+            if (index > 0)
+            {
+                Node* parent = path[index - 1];
+                parentLink = (parent -> left.load(std::memory_order_relaxed) == node) ?
+                             &(parent -> left) : &(parent -> right);
+            }
+            parentLink -> store(rotateCopy(node), std::memory_order_release);
+            break;
+        }
+        if (node -> height == previousHeight)
+        {
+            break;
+        }
+    }
+
+    if (retired.size() >= RETIRE_BATCH)
+    {
+        reclaim();
+    }
+    return true;
+} // end of the method insert
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method finds the node data object with the given
+// string without taking a lock, so any number of threads can call it while
+// another thread inserts.
+//
+// Post: The given pointer will point to the node data object if the string
+// is in this tree. Otherwise, the given pointer does not change.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Parameter: pointer, which will point to the node data object found.
+//
+// Return: True if this method found the string, false otherwise.
+bool ConcurrentBinTree::retrieve(std::string_view key, const NodeData*& pointer) const
+{
+    // Count this search in the parity of the current epoch. The fence keeps
+    // the loads of the links after the count, where the writer can see it.
+    Slot& slot = slots[readerSlot()];
+    unsigned parity = epoch.load() & 1;
+    slot.readers[parity].fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    unsigned long long summary = order.summarize(key);
+    const Node* current = root.load(std::memory_order_acquire);
+    bool found = false;
+    while (current != nullptr && !found)
+    {
+        int comparison = compareKey(key, summary, current);
+        if (comparison < 0)
+        {
+            current = current -> left.load(std::memory_order_acquire);
+        }
+        else if (comparison > 0)
+        {
+            current = current -> right.load(std::memory_order_acquire);
+        }
+        else
+        {
+            pointer = current -> data;
+            found = true;
+        }
+    }
+
+    slot.readers[parity].fetch_sub(1, std::memory_order_release);
+    return found;
+} // end of the method retrieve
+
+// --------------------------------getSize-------------------------------------
+// Description: The method getSize reports the number of strings in this tree.
+//
+// Return: The number of strings.
+int ConcurrentBinTree::getSize() const
+{
+    return size.load(std::memory_order_relaxed);
+} // end of the method getSize
+
+// -------------------------------getHeight------------------------------------
+// Description: The method getHeight reports the height of this tree. It
+// takes the writer's mutex, since only the writer keeps the heights.
+//
+// Return: The height; zero for an empty tree.
+int ConcurrentBinTree::getHeight() const
+{
+    std::lock_guard<std::mutex> guard(writerLock);
+    return heightOf(root.load(std::memory_order_relaxed));
+} // end of the method getHeight
+
+// ------------------------------readerSlot------------------------------------
+// Description: The method readerSlot returns the slot of the calling thread,
+// which it picks the first time the thread searches.
+//
+// Return: The position of the slot.
+int ConcurrentBinTree::readerSlot()
+{
+    static thread_local int slot = static_cast<int>(nextSlot.fetch_add(1) % SLOT_COUNT);
+    return slot;
+} // end of the method readerSlot
+
+// -------------------------------compareKey-----------------------------------
+// Description: The method compareKey orders the given string and the one in
+// the given tree node, comparing the summaries first.
+//
+// Parameter: target, which is the string to compare.
+//
+// Parameter: summary, which is the summary of the given string.
+//
+// Parameter: node, which is the tree node to compare with.
+//
+// Return: A negative number if the given string comes first, zero if the
+// strings are equal, and a positive number otherwise.
+int ConcurrentBinTree::compareKey(std::string_view target, unsigned long long summary,
+                                  const Node* node) const
+{
+    if (summary != node -> summary)
+    {
+        return (summary < node -> summary) ? -1 : 1;
+    }
+    return order.compare(target, node -> data -> getData());
+} // end of the method compareKey
+
+// -------------------------------heightOf-------------------------------------
+// Description: The method heightOf returns the height of the given subtree.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Return: The height; zero for a null pointer.
+int ConcurrentBinTree::heightOf(const Node* node)
+{
+    return (node == nullptr) ? 0 : node -> height;
+} // end of the method heightOf
+
+// --------------------------------update--------------------------------------
+// Description: The method update recomputes the height of the given tree
+// node from the heights of its children.
+//
+// Parameter: node, which is the tree node to update.
+void ConcurrentBinTree::update(Node* node)
+{
+    int left = heightOf(node -> left.load(std::memory_order_relaxed));
+    int right = heightOf(node -> right.load(std::memory_order_relaxed));
+    node -> height = (left > right ? left : right) + 1;
+} // end of the method update
+
+// -------------------------------copyNode-------------------------------------
+// Description: The method copyNode creates a tree node with the key of the
+// given node and the given children, which a rotation publishes in place of
+// the given node.
+//
+// Parameter: source, which is the tree node to copy.
+//
+// Parameter: left, which is the left child of the copy.
+//
+// Parameter: right, which is the right child of the copy.
+//
+// Return: The copy.
+ConcurrentBinTree::Node* ConcurrentBinTree::copyNode(const Node* source, Node* left, Node* right)
+{
+    Node* copy = new Node;
+    copy -> summary = source -> summary;
+    copy -> data = source -> data;
+    copy -> left.store(left, std::memory_order_relaxed);
+    copy -> right.store(right, std::memory_order_relaxed);
+    update(copy);
+    return copy;
+} // end of the method copyNode
+
+// -------------------------------rotateCopy-----------------------------------
+// Description: The method rotateCopy builds the rebalanced copy of the given
+// subtree, whose children differ in height by two, and retires the nodes
+// that it copied.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Return: The root node of the copy, which the caller must publish.
+ConcurrentBinTree::Node* ConcurrentBinTree::rotateCopy(Node* node)
+{
+    Node* left = node -> left.load(std::memory_order_relaxed);
+    Node* right = node -> right.load(std::memory_order_relaxed);
+    Node* raised;
+    if (heightOf(left) > heightOf(right))
+    {
+        Node* outer = left -> left.load(std::memory_order_relaxed);
+        Node* inner = left -> right.load(std::memory_order_relaxed);
+        if (heightOf(outer) >= heightOf(inner))
+        {
+            // A single right rotation: the left child rises.
+            Node* lowered = copyNode(node, inner, right);
+            raised = copyNode(left, outer, lowered);
+        }
+        else
+        {
+            // A double rotation: the inner grandchild rises over both.
+            Node* newLeft = copyNode(left, outer, inner -> left.load(std::memory_order_relaxed));
+            Node* newRight = copyNode(node, inner -> right.load(std::memory_order_relaxed), right);
+            raised = copyNode(inner, newLeft, newRight);
+            retired.push_back(inner);
+        }
+        retired.push_back(left);
+    }
+    else
+    {
+        Node* outer = right -> right.load(std::memory_order_relaxed);
+        Node* inner = right -> left.load(std::memory_order_relaxed);
+        if (heightOf(outer) >= heightOf(inner))
+        {
+            Node* lowered = copyNode(node, left, inner);
+            raised = copyNode(right, lowered, outer);
+        }
+        else
+        {
+            Node* newLeft = copyNode(node, left, inner -> left.load(std::memory_order_relaxed));
+            Node* newRight = copyNode(right, inner -> right.load(std::memory_order_relaxed), outer);
+            raised = copyNode(inner, newLeft, newRight);
+            retired.push_back(inner);
+        }
+        retired.push_back(right);
+    }
+    retired.push_back(node);
+    return raised;
+} // end of the method rotateCopy
+
+// -------------------------------synchronize----------------------------------
+// Description: The method synchronize waits until every search that might
+// still see a retired node has finished. It flips the epoch twice, waiting
+// each time for the counters of the parity that new searches no longer use.
+void ConcurrentBinTree::synchronize()
+{
+    // A search that the wait misses counted itself after the wait looked,
+    // and the fences order its loads after the stores that unlinked the
+    // retired nodes, so it cannot reach them.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (int round = 0; round < 2; round++)
+    {
+        unsigned parity = epoch.fetch_add(1) & 1;
+        for (int index = 0; index < SLOT_COUNT; index++)
+        {
+            while (slots[index].readers[parity].load() != 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+} // end of the method synchronize
+
+// --------------------------------reclaim-------------------------------------
+// Description: The method reclaim waits for a grace period and frees the
+// retired tree nodes.
+void ConcurrentBinTree::reclaim()
+{
+    synchronize();
+    for (size_t index = 0; index < retired.size(); index++)
+    {
+        delete retired[index];
+    }
+    retired.clear();
+} // end of the method reclaim
\ No newline at end of file
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bintree.h"
+#include "nodedata.h"
+
+// ----------------------------- concurrentbintree.h ------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the ConcurrentBinTree class, a binary
+// search tree of strings that many threads can search while other threads
+// insert. Searches take no lock: they follow atomic child pointers from an
+// atomic root. Inserts take one mutex, so there is one writer at a time, and
+// keep the tree balanced as an AVL tree.
+//
+// Note: The writer never changes a tree node that a reader may be standing on,
+// except to hang a new leaf from it. A rotation copies the two or three nodes it
+// moves and publishes the copies with one store into the parent, so a reader
+// that is inside the old nodes still sees a valid tree with every key it could
+// have found before. The old nodes are retired and freed in batches after a
+// grace period: every search counts itself in one of two counters per slot,
+// chosen by the parity of an epoch, and the writer flips the epoch and waits
+// for the counters of each parity to drain before it frees anything.
+//
+// Note: There is no remove, so a node data object lives as long as the tree, and
+// the pointer that retrieve returns stays valid until the tree is destroyed.
+// --------------------------------------------------------------------------------
+
+class ConcurrentBinTree
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates an empty tree whose keys are
+    // sorted in the given order.
+    //
+    // Post: An empty tree exists.
+    //
+    // Parameter: order, which is the order of the keys in this tree.
+    explicit ConcurrentBinTree(const BinTree::KeyOrder& order = BinTree::LEXICAL_ORDER);
+
+    // ------------------------------Destructor------------------------------------
+    // Description: The destructor frees every tree node and node data object.
+    //
+    // Pre: No other thread is using this tree.
+    //
+    // Post: This tree does not exist, and its memory is free.
+    ~ConcurrentBinTree();
+
+    ConcurrentBinTree(const ConcurrentBinTree&) = delete;
+    ConcurrentBinTree& operator=(const ConcurrentBinTree&) = delete;
+
+    // --------------------------------insert--------------------------------------
+    // Description: The method insert adds a node data object with the given
+    // string to this tree and rebalances it. Threads that insert at the same
+    // time take turns; threads that search are never blocked, but the insert
+    // that fills a batch of retired nodes waits for the searches that started
+    // before it to finish.
+    //
+    // Post: The string is in this tree. Searches that start after this method
+    // returns find it.
+    //
+    // Parameter: value, the string to insert.
+    //
+    // Return: True if this method added the string; false if it was already in
+    // this tree.
+    bool insert(const std::string& value);
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method finds the node data object with the given
+    // string without taking a lock, so any number of threads can call it while
+    // another thread inserts.
+    //
+    // Post: The given pointer will point to the node data object if the string
+    // is in this tree. Otherwise, the given pointer does not change.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Parameter: pointer, which will point to the node data object found.
+    //
+    // Return: True if this method found the string, false otherwise.
+    bool retrieve(std::string_view key, const NodeData*& pointer) const;
+
+    // --------------------------------getSize-------------------------------------
+    // Description: The method getSize reports the number of strings in this tree.
+    //
+    // Return: The number of strings.
+    int getSize() const;
+
+    // -------------------------------getHeight------------------------------------
+    // Description: The method getHeight reports the height of this tree. It
+    // takes the writer's mutex, since only the writer keeps the heights.
+    //
+    // Return: The height; zero for an empty tree.
+    int getHeight() const;
+
+private:
+    // A tree node. The summary and the data never change after the node is
+    // published; the child pointers change only to hang a new leaf or a
+    // rotated copy. The height is read and written only by the writer.
+    struct Node
+    {
+        unsigned long long summary;
+        const NodeData* data;
+        std::atomic<Node*> left;
+        std::atomic<Node*> right;
+        int height;
+    };
+
+    // The searches of each thread count themselves in one of SLOT_COUNT slots,
+    // each on its own cache line, so readers rarely write the same line.
+    static const int SLOT_COUNT = 64;
+
+    // The writer frees retired nodes once RETIRE_BATCH of them have piled up,
+    // so one grace period covers many inserts.
+    static const size_t RETIRE_BATCH = 1024;
+
+    // The deepest path an AVL tree can have for any tree that fits in memory.
+    static const int MAX_HEIGHT = 96;
+
+    struct alignas(64) Slot
+    {
+        std::atomic<long> readers[2];
+    };
+
+    std::atomic<Node*> root;
+    BinTree::KeyOrder order;
+    std::atomic<int> size;
+    std::atomic<unsigned> epoch;
+    mutable Slot slots[SLOT_COUNT];
+    mutable std::mutex writerLock;
+    std::vector<Node*> retired;
+
+    // ------------------------------readerSlot------------------------------------
+    // Description: The method readerSlot returns the slot of the calling thread,
+    // which it picks the first time the thread searches.
+    //
+    // Return: The position of the slot.
+    static int readerSlot();
+
+    // -------------------------------compareKey-----------------------------------
+    // Description: The method compareKey orders the given string and the one in
+    // the given tree node, comparing the summaries first.
+    //
+    // Parameter: target, which is the string to compare.
+    //
+    // Parameter: summary, which is the summary of the given string.
+    //
+    // Parameter: node, which is the tree node to compare with.
+    //
+    // Return: A negative number if the given string comes first, zero if the
+    // strings are equal, and a positive number otherwise.
+    int compareKey(std::string_view target, unsigned long long summary, const Node* node) const;
+
+    // -------------------------------heightOf-------------------------------------
+    // Description: The method heightOf returns the height of the given subtree.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The height; zero for a null pointer.
+    static int heightOf(const Node* node);
+
+    // --------------------------------update--------------------------------------
+    // Description: The method update recomputes the height of the given tree
+    // node from the heights of its children.
+    //
+    // Parameter: node, which is the tree node to update.
+    static void update(Node* node);
+
+    // -------------------------------copyNode-------------------------------------
+    // Description: The method copyNode creates a tree node with the key of the
+    // given node and the given children, which a rotation publishes in place of
+    // the given node.
+    //
+    // Parameter: source, which is the tree node to copy.
+    //
+    // Parameter: left, which is the left child of the copy.
+    //
+    // Parameter: right, which is the right child of the copy.
+    //
+    // Return: The copy.
+    static Node* copyNode(const Node* source, Node* left, Node* right);
+
+    // -------------------------------rotateCopy-----------------------------------
+    // Description: The method rotateCopy builds the rebalanced copy of the given
+    // subtree, whose children differ in height by two, and retires the nodes
+    // that it copied.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The root node of the copy, which the caller must publish.
+    Node* rotateCopy(Node* node);
+
+    // -------------------------------synchronize----------------------------------
+    // Description: The method synchronize waits until every search that might
+    // still see a retired node has finished. It flips the epoch twice, waiting
+    // each time for the counters of the parity that new searches no longer use.
+    void synchronize();
+
+    // --------------------------------reclaim-------------------------------------
+    // Description: The method reclaim waits for a grace period and frees the
+    // retired tree nodes.
+    void reclaim();
+};
\ No newline at end of file
@@ -12,13 +12,12 @@
 #include "bintree.h"
 #include <fstream>
 #include <iostream>
+#include <vector>
 using namespace std;
 
-const int ARRAYSIZE = 100;
-
 //global function prototypes
 void buildTree(BinTree&, ifstream&);      // 
-void initArray(NodeData*[]);             // initialize array to NULL
+void initArray(vector<NodeData*>&);      // empty out the array
 
 int main() {
 	// create file object infile and open it
@@ -41,7 +40,7 @@ int main() {
 	NodeData tND("t");
 
 	BinTree T, T2, dup;
-	NodeData* ndArray[ARRAYSIZE];
+	vector<NodeData*> ndArray;         // grows to fit any tree
 	initArray(ndArray);
 	cout << "Initial data:" << endl << "  ";
 	buildTree(T, infile);              // builds and displays initial data
@@ -122,19 +121,15 @@ void buildTree(BinTree& T, ifstream& infile) {
 		cout << s << ' ';
 		if (s == "$$") break;                // at end of one line
 		if (infile.eof()) break;             // no more lines of data
-		NodeData* ptr = new NodeData(s);     // NodeData constructor takes string
-		// would do a setData if there were more than a string
-
-		bool success = T.insert(ptr);
-		if (!success)
-			delete ptr;                       // duplicate case, not inserted 
+		// the tree keeps the NodeData in its node pool, and a duplicate
+		// is found before anything is allocated
+		T.insert(s);
 	}
 }
 
 //------------------------------- initArray ----------------------------------
-// initialize the array of NodeData* to NULL pointers
+// empty out the array of NodeData*; the tree owns what was in it
 
-void initArray(NodeData* ndArray[]) {
-	for (int i = 0; i < ARRAYSIZE; i++)
-		ndArray[i] = NULL;
+void initArray(vector<NodeData*>& ndArray) {
+	ndArray.clear();
 }
@@ -0,0 +1,263 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <climits>
+#include <cstring>
+#include "mappedbintree.h"
+#include "treeformat.h"
+
+// ---------------------------- mappedbintree.cpp -----------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the MappedBinTree class,
+// which searches a saved binary search tree in a memory-mapped file.
+// ----------------------------------------------------------------------------
+
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates a tree with no file, whose
+// keys are compared in the given order.
+//
+// Post: A tree that holds no strings exists.
+//
+// Parameter: order, which should be the key order of the tree that saved
+// the file.
+MappedBinTree::MappedBinTree(const BinTree::KeyOrder& order) :
+order(order), image(nullptr), imageSize(0), recordsEnd(nullptr), restarts(nullptr),
+restartCount(0), count(0), restartInterval(1)
+{
+
+} // end of the default constructor
+
+// ------------------------------Destructor------------------------------------
+// Description: The destructor unmaps the file.
+//
+// Post: This tree does not exist.
+MappedBinTree::~MappedBinTree()
+{
+    close();
+} // end of the destructor
+
+// ---------------------------------open---------------------------------------
+// Description: The method open maps the given file and checks its header,
+// its trailer and the size of its restart table.
+//
+// Post: If this method succeeded, this tree serves the strings in the file.
+// Otherwise this tree holds no strings. A file opened before is unmapped
+// either way.
+//
+// Parameter: fileName, which is the name of the file.
+//
+// Return: True if the file was mapped and holds a valid image; false
+// otherwise.
+bool MappedBinTree::open(const std::string& fileName)
+{
+    close();
+    int descriptor = ::open(fileName.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 ||
+        status.st_size < static_cast<off_t>(TreeFormat::HEADER_SIZE + TreeFormat::TRAILER_SIZE))
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    // The mapping keeps the file open by itself.
+    size_t size = static_cast<size_t>(status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    image = static_cast<const unsigned char*>(mapping);
+    imageSize = size;
+
+    // The restart table lies between the records and the trailer and holds
+    // one offset per restart interval of strings.
+    const unsigned char* trailer = image + size - TreeFormat::TRAILER_SIZE;
+    unsigned long long table = TreeFormat::getFixed64(trailer);
+    if (!TreeFormat::getHeader(image, size, count, restartInterval) ||
+        std::memcmp(trailer + 8, TreeFormat::MAGIC, sizeof(TreeFormat::MAGIC)) != 0 ||
+        table < TreeFormat::HEADER_SIZE || table > size - TreeFormat::TRAILER_SIZE ||
+        (size - TreeFormat::TRAILER_SIZE - table) % 8 != 0 ||
+        count > INT_MAX || (size - TreeFormat::TRAILER_SIZE - table) / 8 !=
+            count / restartInterval + (count % restartInterval != 0))
+    {
+        close();
+        return false;
+    }
+    recordsEnd = image + table;
+    restarts = image + table;
+    restartCount = (size - TreeFormat::TRAILER_SIZE - table) / 8;
+    return true;
+} // end of the method open
+
+// ---------------------------------close--------------------------------------
+// Description: The method close unmaps the file, if any.
+//
+// Post: This tree holds no strings.
+void MappedBinTree::close()
+{
+    if (image != nullptr)
+    {
+        munmap(const_cast<unsigned char*>(image), imageSize);
+    }
+    image = nullptr;
+    imageSize = 0;
+    recordsEnd = nullptr;
+    restarts = nullptr;
+    restartCount = 0;
+    count = 0;
+    restartInterval = 1;
+} // end of the method close
+
+// --------------------------------isOpen--------------------------------------
+// Description: The method isOpen reports whether a file is mapped.
+//
+// Return: True if a file is mapped; false otherwise.
+bool MappedBinTree::isOpen() const
+{
+    return image != nullptr;
+} // end of the method isOpen
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method reports whether the given string is in
+// the file. It takes O(log n) comparisons over the restart points plus at
+// most one restart interval of records, and allocates nothing for short
+// strings.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Return: True if the string is in the file; false otherwise, or if a
+// damaged record is reached.
+bool MappedBinTree::retrieve(std::string_view key) const
+{
+    unsigned long long summary = order.summarize(key);
+
+    // Find the number of restart points whose strings come before the given
+    // one; the string, if it is anywhere, is in the interval of the last.
+    size_t low = 0;
+    size_t high = restartCount;
+    std::string_view found;
+    const unsigned char* record = nullptr;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (!restartKey(middle, found, record))
+        {
+            return false;
+        }
+        int comparison = compareKey(key, summary, found);
+        if (comparison == 0)
+        {
+            return true;
+        }
+        if (comparison < 0)
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+    if (low == 0 || !restartKey(low - 1, found, record))
+    {
+        return false;
+    }
+
+    // The restart string is already known to come first, so the scan starts
+    // with the record after it.
+    std::string current(found);
+    unsigned long long first = (low - 1) * static_cast<unsigned long long>(restartInterval);
+    for (unsigned long long index = first + 1; index < count && index < first + restartInterval;
+         index++)
+    {
+        if (!TreeFormat::getRecord(record, recordsEnd, current))
+        {
+            return false;
+        }
+        int comparison = compareKey(key, summary, current);
+        if (comparison <= 0)
+        {
+            return comparison == 0;
+        }
+    }
+    return false;
+} // end of the method retrieve
+
+// --------------------------------getSize-------------------------------------
+// Description: The method getSize reports the number of strings in the file.
+//
+// Return: The number of strings; zero if no file is mapped.
+int MappedBinTree::getSize() const
+{
+    return static_cast<int>(count);
+} // end of the method getSize
+
+// -------------------------------compareKey-----------------------------------
+// Description: The method compareKey orders the given strings, comparing
+// their summaries first.
+//
+// Parameter: target, which is the string to compare.
+//
+// Parameter: summary, which is the summary of the given string.
+//
+// Parameter: key, which is the string to compare with.
+//
+// Return: A negative number if the target comes first, zero if the strings
+// are equal, and a positive number otherwise.
+int MappedBinTree::compareKey(std::string_view target, unsigned long long summary,
+                              std::string_view key) const
+{
+    unsigned long long keySummary = order.summarize(key);
+    if (summary != keySummary)
+    {
+        return (summary < keySummary) ? -1 : 1;
+    }
+    return order.compare(target, key);
+} // end of the method compareKey
+
+// -------------------------------restartKey-----------------------------------
+// Description: The method restartKey finds the string of the given restart
+// point in the mapping.
+//
+// Parameter: index, which is the position of the restart point.
+//
+// Parameter: key, which receives the string.
+//
+// Parameter: record, which receives the position just after the record.
+//
+// Return: True if the restart point leads to a valid record; false
+// otherwise.
+bool MappedBinTree::restartKey(size_t index, std::string_view& key,
+                               const unsigned char*& record) const
+{
+    unsigned long long offset = TreeFormat::getFixed64(restarts + 8 * index);
+    if (offset < TreeFormat::HEADER_SIZE || offset >= static_cast<size_t>(recordsEnd - image))
+    {
+        return false;
+    }
+
+    // A restart shares no bytes, so its string lies whole in the mapping.
+    const unsigned char* cursor = image + offset;
+    unsigned long long shared = 0;
+    unsigned long long length = 0;
+    if (!TreeFormat::getVarint(cursor, recordsEnd, shared) ||
+        !TreeFormat::getVarint(cursor, recordsEnd, length) || shared != 0 ||
+        length > static_cast<unsigned long long>(recordsEnd - cursor))
+    {
+        return false;
+    }
+    key = std::string_view(reinterpret_cast<const char*>(cursor), length);
+    record = cursor + length;
+    return true;
+} // end of the method restartKey
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "bintree.h"
+
+// -------------------------------- mappedbintree.h -------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the MappedBinTree class, which serves
+// retrieve straight from a file that BinTree::save wrote. The file is mapped
+// into memory read-only, so opening it reads nothing but the header and the
+// trailer, and no tree node or node data object is ever built. A search does a
+// binary search over the restart points of the image, whose strings are stored
+// whole, and then decodes at most one restart interval of records.
+//
+// Note: The mapping uses the POSIX calls mmap and munmap. Pages of the file are
+// read when a search first touches them, and processes that map the same file
+// share them.
+// --------------------------------------------------------------------------------
+
+class MappedBinTree
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates a tree with no file, whose
+    // keys are compared in the given order.
+    //
+    // Post: A tree that holds no strings exists.
+    //
+    // Parameter: order, which should be the key order of the tree that saved
+    // the file.
+    explicit MappedBinTree(const BinTree::KeyOrder& order = BinTree::LEXICAL_ORDER);
+
+    // ------------------------------Destructor------------------------------------
+    // Description: The destructor unmaps the file.
+    //
+    // Post: This tree does not exist.
+    ~MappedBinTree();
+
+    MappedBinTree(const MappedBinTree&) = delete;
+    MappedBinTree& operator=(const MappedBinTree&) = delete;
+
+    // ---------------------------------open---------------------------------------
+    // Description: The method open maps the given file and checks its header,
+    // its trailer and the size of its restart table.
+    //
+    // Post: If this method succeeded, this tree serves the strings in the file.
+    // Otherwise this tree holds no strings. A file opened before is unmapped
+    // either way.
+    //
+    // Parameter: fileName, which is the name of the file.
+    //
+    // Return: True if the file was mapped and holds a valid image; false
+    // otherwise.
+    bool open(const std::string& fileName);
+
+    // ---------------------------------close--------------------------------------
+    // Description: The method close unmaps the file, if any.
+    //
+    // Post: This tree holds no strings.
+    void close();
+
+    // --------------------------------isOpen--------------------------------------
+    // Description: The method isOpen reports whether a file is mapped.
+    //
+    // Return: True if a file is mapped; false otherwise.
+    bool isOpen() const;
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method reports whether the given string is in
+    // the file. It takes O(log n) comparisons over the restart points plus at
+    // most one restart interval of records, and allocates nothing for short
+    // strings.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Return: True if the string is in the file; false otherwise, or if a
+    // damaged record is reached.
+    bool retrieve(std::string_view key) const;
+
+    // --------------------------------getSize-------------------------------------
+    // Description: The method getSize reports the number of strings in the file.
+    //
+    // Return: The number of strings; zero if no file is mapped.
+    int getSize() const;
+
+private:
+    BinTree::KeyOrder order;
+
+    // The mapping, the records within it, which end where the restart table
+    // starts, and the restart table.
+    const unsigned char* image;
+    size_t imageSize;
+    const unsigned char* recordsEnd;
+    const unsigned char* restarts;
+    size_t restartCount;
+    unsigned long long count;
+    unsigned restartInterval;
+
+    // -------------------------------compareKey-----------------------------------
+    // Description: The method compareKey orders the given strings, comparing
+    // their summaries first.
+    //
+    // Parameter: target, which is the string to compare.
+    //
+    // Parameter: summary, which is the summary of the given string.
+    //
+    // Parameter: key, which is the string to compare with.
+    //
+    // Return: A negative number if the target comes first, zero if the strings
+    // are equal, and a positive number otherwise.
+    int compareKey(std::string_view target, unsigned long long summary, std::string_view key) const;
+
+    // -------------------------------restartKey-----------------------------------
+    // Description: The method restartKey finds the string of the given restart
+    // point in the mapping.
+    //
+    // Parameter: index, which is the position of the restart point.
+    //
+    // Parameter: key, which receives the string.
+    //
+    // Parameter: record, which receives the position just after the record.
+    //
+    // Return: True if the restart point leads to a valid record; false
+    // otherwise.
+    bool restartKey(size_t index, std::string_view& key, const unsigned char*& record) const;
+};
\ No newline at end of file
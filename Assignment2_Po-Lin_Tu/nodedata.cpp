@@ -43,6 +43,18 @@ bool NodeData::operator>=(const NodeData& rhs) const {
 	return data >= rhs.data;
 }
 
+//------------------------------ compare -------------------------------------
+// one string comparison instead of two of the operators above
+
+int NodeData::compare(const NodeData& rhs) const {
+	return data.compare(rhs.data);
+}
+
+//------------------------------ getData -------------------------------------
+const string& NodeData::getData() const {
+	return data;
+}
+
 //------------------------------ setData -------------------------------------
 // returns true if the data is set, false when bad data, i.e., is eof
 
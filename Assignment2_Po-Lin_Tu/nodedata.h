@@ -29,6 +29,12 @@ public:
 	bool operator<=(const NodeData &) const;
 	bool operator>=(const NodeData &) const;
 
+	// three-way comparison, negative, zero or positive when this object
+	// comes before, equals or comes after the parameter
+	int compare(const NodeData &) const;
+
+	const string& getData() const;     // the string this object contains
+
 private:
 	string data;
 };
@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <new>
+#include <utility>
+#include "nodepool.h"
+
+// ------------------------------ nodepool.cpp --------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the NodePool class that
+// hands out the tree nodes of one binary search tree in chunks.
+// ----------------------------------------------------------------------------
+
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an empty pool.
+//
+// Post: An empty pool, which has not allocated any chunk, exists.
+NodePool::NodePool() : nodeCount(0)
+{
+
+} // end of the default constructor
+
+// ------------------------------Destructor------------------------------------
+// Description: The destructor destroys every tree node in this pool and
+// frees the chunks.
+//
+// Post: This pool does not exist, and the chunks are free.
+NodePool::~NodePool()
+{
+    release();
+} // end of the destructor
+
+// --------------------------------makeNode------------------------------------
+// Description: The method makeNode creates a tree node that adopts the given
+// dynamically allocated node data object.
+//
+// Pre: The given node data object must be dynamically allocated.
+//
+// Post: A tree node without children exists in this pool. The node data
+// object is deleted when the pool is released.
+//
+// Parameter: dataPtr, the node data object for the tree node.
+//
+// Return: The new tree node.
+TreeNode* NodePool::makeNode(NodeData* dataPtr)
+{
+    return new (slot()) TreeNode(dataPtr, nullptr, nullptr);
+} // end of the method makeNode
+
+// --------------------------------makeNode------------------------------------
+// Description: The method makeNode creates a tree node that stores a copy
+// of the given node data object in itself.
+//
+// Post: A tree node without children exists in this pool.
+//
+// Parameter: value, the node data object to copy.
+//
+// Return: The new tree node.
+TreeNode* NodePool::makeNode(const NodeData& value)
+{
+    TreeNode* node = new (slot()) TreeNode();
+    node -> data = new (node -> storage) NodeData(value);
+    node -> embedded = true;
+    return node;
+} // end of the method makeNode
+
+// --------------------------------makeNode------------------------------------
+// Description: The method makeNode creates a tree node that stores a node
+// data object with the given string in itself.
+//
+// Post: A tree node without children exists in this pool.
+//
+// Parameter: value, the string for the node data object.
+//
+// Return: The new tree node.
+TreeNode* NodePool::makeNode(const std::string& value)
+{
+    TreeNode* node = new (slot()) TreeNode();
+    node -> data = new (node -> storage) NodeData(value);
+    node -> embedded = true;
+    return node;
+} // end of the method makeNode
+
+// --------------------------------release-------------------------------------
+// Description: The method release destroys every tree node in this pool and
+// frees the chunks, and lets go of the blocks it shares.
+//
+// Post: This pool is empty. Pointers to its objects are no longer valid.
+void NodePool::release()
+{
+    for (size_t index = 0; index < chunks.size(); index++)
+    {
+        for (size_t i = 0; i < chunks[index].used; i++)
+        {
+            chunks[index].nodes[i].~TreeNode();
+        }
+        ::operator delete(chunks[index].nodes);
+    }
+    chunks.clear();
+    nodeCount = 0;
+    shared.clear();
+} // end of the method release
+
+// --------------------------------reserve-------------------------------------
+// Description: The method reserve makes room for the given number of tree
+// nodes in one chunk, so that the next that many tree nodes are contiguous.
+//
+// Post: The last chunk has room for at least the given number of tree nodes.
+//
+// Parameter: count, which is the number of tree nodes to make room for.
+void NodePool::reserve(size_t count)
+{
+    if (count > 0 && (chunks.empty() || chunks.back().capacity - chunks.back().used < count))
+    {
+        addChunk(count);
+    }
+} // end of the method reserve
+
+// --------------------------------makeNodes-----------------------------------
+// Description: The method makeNodes creates the given number of empty tree
+// nodes next to each other in one chunk, so that several threads can fill
+// them at once without sharing the pool.
+//
+// Post: The tree nodes exist in this pool and have no data and no children.
+//
+// Parameter: count, which is the number of tree nodes to create.
+//
+// Return: The first of the tree nodes; a null pointer if the count is zero.
+TreeNode* NodePool::makeNodes(size_t count)
+{
+    if (count == 0)
+    {
+        return nullptr;
+    }
+    reserve(count);
+    Chunk& chunk = chunks.back();
+    TreeNode* nodes = chunk.nodes + chunk.used;
+    for (size_t index = 0; index < count; index++)
+    {
+        new (nodes + index) TreeNode();
+    }
+    chunk.used += count;
+    nodeCount += count;
+    return nodes;
+} // end of the method makeNodes
+
+// -----------------------------getNodeCount-----------------------------------
+// Description: The method getNodeCount reports the number of tree nodes in
+// the chunks of this pool, not counting the blocks it shares.
+//
+// Return: The number of tree nodes.
+size_t NodePool::getNodeCount() const
+{
+    return nodeCount;
+} // end of the method getNodeCount
+
+// ---------------------------------swap---------------------------------------
+// Description: The method swap exchanges the tree nodes of this pool and the
+// given one, so a tree can be built in a pool of its own and then handed over.
+//
+// Post: Each pool holds the tree nodes that the other one held.
+//
+// Parameter: other, which is the pool to swap with.
+void NodePool::swap(NodePool& other)
+{
+    chunks.swap(other.chunks);
+    std::swap(nodeCount, other.nodeCount);
+    shared.swap(other.shared);
+} // end of the method swap
+
+// ------------------------------------share------------------------------------
+// Description: The method share hands the chunks of this pool to a block
+// that this pool and the given one both hold, so the tree nodes in it live
+// until both pools release it. New tree nodes go to new chunks of each pool,
+// so the two pools may then be used by different threads.
+//
+// Post: Both pools hold every block that this pool held.
+//
+// Parameter: other, which is the pool to share with.
+void NodePool::share(NodePool& other)
+{
+    if (!chunks.empty())
+    {
+        std::shared_ptr<NodePool> block = std::make_shared<NodePool>();
+        block -> chunks.swap(chunks);
+        block -> nodeCount = nodeCount;
+        nodeCount = 0;
+        shared.push_back(block);
+    }
+    other.shared.insert(other.shared.end(), shared.begin(), shared.end());
+} // end of the method share
+
+// ------------------------------------adopt------------------------------------
+// Description: The method adopt takes over the chunks and the blocks of the
+// given pool, whose tree nodes now live as long as this pool.
+//
+// Post: The given pool is empty.
+//
+// Parameter: other, which is the pool to take over.
+void NodePool::adopt(NodePool& other)
+{
+    chunks.insert(chunks.end(), other.chunks.begin(), other.chunks.end());
+    nodeCount += other.nodeCount;
+    other.chunks.clear();
+    other.nodeCount = 0;
+
+    // Blocks that both pools held are held once.
+    shared.insert(shared.end(), other.shared.begin(), other.shared.end());
+    other.shared.clear();
+    std::sort(shared.begin(), shared.end());
+    shared.erase(std::unique(shared.begin(), shared.end()), shared.end());
+} // end of the method adopt
+
+// -------------------------------chunkSize------------------------------------
+// Description: The method chunkSize returns the number of tree nodes that a
+// chunk holds when reserve does not ask for more.
+//
+// Parameter: index, which is the position of the chunk.
+//
+// Return: The number of tree nodes in the chunk.
+size_t NodePool::chunkSize(size_t index)
+{
+    size_t size = FIRST_CHUNK;
+    while (index > 0 && size < LARGEST_CHUNK)
+    {
+        size *= 2;
+        index--;
+    }
+    return size;
+} // end of the method chunkSize
+
+// ---------------------------------slot---------------------------------------
+// Description: The method slot returns raw memory for the next tree node,
+// adding a chunk when the last one is full.
+//
+// Return: The memory for the tree node.
+void* NodePool::slot()
+{
+    if (chunks.empty() || chunks.back().used == chunks.back().capacity)
+    {
+        addChunk(chunkSize(chunks.size()));
+    }
+    nodeCount++;
+    return chunks.back().nodes + chunks.back().used++;
+} // end of the method slot
+
+// -------------------------------addChunk-------------------------------------
+// Description: The method addChunk adds an empty chunk for the given number
+// of tree nodes.
+//
+// Parameter: capacity, which is the number of tree nodes.
+void NodePool::addChunk(size_t capacity)
+{
+    Chunk chunk;
+    chunk.nodes = static_cast<TreeNode*>(::operator new(capacity * sizeof(TreeNode)));
+    chunk.capacity = capacity;
+    chunk.used = 0;
+    chunks.push_back(chunk);
+} // end of the method addChunk
\ No newline at end of file
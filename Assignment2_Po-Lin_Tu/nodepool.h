@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "treenode.h"
+
+// ---------------------------------- nodepool.h ----------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the NodePool class that hands out the
+// tree nodes of one binary search tree. The NodePool class allocates them in
+// chunks, so building a tree takes a few allocations per thousand nodes instead
+// of two per node, neighboring nodes share cache lines, and emptying the tree
+// frees a handful of chunks instead of every node.
+//
+// Note: The NodePool class never frees a single tree node. The tree nodes that
+// it hands out live until release is invoked. When a split moves tree nodes to
+// another tree, the chunks that hold them become a block that both pools hold,
+// and the block is freed when the last of them releases it.
+// --------------------------------------------------------------------------------
+
+class NodePool
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates an empty pool.
+    //
+    // Post: An empty pool, which has not allocated any chunk, exists.
+    NodePool();
+
+    // ------------------------------Destructor------------------------------------
+    // Description: The destructor destroys every tree node in this pool and
+    // frees the chunks.
+    //
+    // Post: This pool does not exist, and the chunks are free.
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // --------------------------------makeNode------------------------------------
+    // Description: The method makeNode creates a tree node that adopts the given
+    // dynamically allocated node data object.
+    //
+    // Pre: The given node data object must be dynamically allocated.
+    //
+    // Post: A tree node without children exists in this pool. The node data
+    // object is deleted when the pool is released.
+    //
+    // Parameter: dataPtr, the node data object for the tree node.
+    //
+    // Return: The new tree node.
+    TreeNode* makeNode(NodeData* dataPtr);
+
+    // --------------------------------makeNode------------------------------------
+    // Description: The method makeNode creates a tree node that stores a copy
+    // of the given node data object in itself.
+    //
+    // Post: A tree node without children exists in this pool.
+    //
+    // Parameter: value, the node data object to copy.
+    //
+    // Return: The new tree node.
+    TreeNode* makeNode(const NodeData& value);
+
+    // --------------------------------makeNode------------------------------------
+    // Description: The method makeNode creates a tree node that stores a node
+    // data object with the given string in itself.
+    //
+    // Post: A tree node without children exists in this pool.
+    //
+    // Parameter: value, the string for the node data object.
+    //
+    // Return: The new tree node.
+    TreeNode* makeNode(const std::string& value);
+
+    // --------------------------------release-------------------------------------
+    // Description: The method release destroys every tree node in this pool and
+    // frees the chunks, and lets go of the blocks it shares.
+    //
+    // Post: This pool is empty. Pointers to its objects are no longer valid.
+    void release();
+
+    // --------------------------------reserve-------------------------------------
+    // Description: The method reserve makes room for the given number of tree
+    // nodes in one chunk, so that the next that many tree nodes are contiguous.
+    //
+    // Post: The last chunk has room for at least the given number of tree nodes.
+    //
+    // Parameter: count, which is the number of tree nodes to make room for.
+    void reserve(size_t count);
+
+    // --------------------------------makeNodes-----------------------------------
+    // Description: The method makeNodes creates the given number of empty tree
+    // nodes next to each other in one chunk, so that several threads can fill
+    // them at once without sharing the pool.
+    //
+    // Post: The tree nodes exist in this pool and have no data and no children.
+    //
+    // Parameter: count, which is the number of tree nodes to create.
+    //
+    // Return: The first of the tree nodes; a null pointer if the count is zero.
+    TreeNode* makeNodes(size_t count);
+
+    // -----------------------------getNodeCount-----------------------------------
+    // Description: The method getNodeCount reports the number of tree nodes in
+    // the chunks of this pool, not counting the blocks it shares.
+    //
+    // Return: The number of tree nodes.
+    size_t getNodeCount() const;
+
+    // ---------------------------------swap---------------------------------------
+    // Description: The method swap exchanges the tree nodes of this pool and the
+    // given one, so a tree can be built in a pool of its own and then handed over.
+    //
+    // Post: Each pool holds the tree nodes that the other one held.
+    //
+    // Parameter: other, which is the pool to swap with.
+    void swap(NodePool& other);
+
+    // ------------------------------------share------------------------------------
+    // Description: The method share hands the chunks of this pool to a block
+    // that this pool and the given one both hold, so the tree nodes in it live
+    // until both pools release it. New tree nodes go to new chunks of each pool,
+    // so the two pools may then be used by different threads.
+    //
+    // Post: Both pools hold every block that this pool held.
+    //
+    // Parameter: other, which is the pool to share with.
+    void share(NodePool& other);
+
+    // ------------------------------------adopt------------------------------------
+    // Description: The method adopt takes over the chunks and the blocks of the
+    // given pool, whose tree nodes now live as long as this pool.
+    //
+    // Post: The given pool is empty.
+    //
+    // Parameter: other, which is the pool to take over.
+    void adopt(NodePool& other);
+
+private:
+    // The first chunk holds FIRST_CHUNK tree nodes, and each later chunk holds
+    // twice as many as the one before, up to LARGEST_CHUNK, unless reserve asks
+    // for a larger one.
+    static const size_t FIRST_CHUNK = 64;
+    static const size_t LARGEST_CHUNK = 8192;
+
+    // A block of memory for capacity tree nodes, the first used of which are
+    // constructed.
+    struct Chunk
+    {
+        TreeNode* nodes;
+        size_t capacity;
+        size_t used;
+    };
+
+    std::vector<Chunk> chunks;
+    size_t nodeCount;
+
+    // The blocks of chunks that this pool shares with other pools.
+    std::vector<std::shared_ptr<NodePool>> shared;
+
+    // -------------------------------chunkSize------------------------------------
+    // Description: The method chunkSize returns the number of tree nodes that a
+    // chunk holds when reserve does not ask for more.
+    //
+    // Parameter: index, which is the position of the chunk.
+    //
+    // Return: The number of tree nodes in the chunk.
+    static size_t chunkSize(size_t index);
+
+    // ---------------------------------slot---------------------------------------
+    // Description: The method slot returns raw memory for the next tree node,
+    // adding a chunk when the last one is full.
+    //
+    // Return: The memory for the tree node.
+    void* slot();
+
+    // -------------------------------addChunk-------------------------------------
+    // Description: The method addChunk adds an empty chunk for the given number
+    // of tree nodes.
+    //
+    // Parameter: capacity, which is the number of tree nodes.
+    void addChunk(size_t capacity);
+};
\ No newline at end of file
@@ -0,0 +1,385 @@
+#include "persistentbintree.h"
+
+// --------------------------- persistentbintree.cpp ---------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the PersistentBinTree
+// class, a binary search tree of strings whose versions share their tree
+// nodes, so that a snapshot takes O(1) time and an insert O(log n) nodes.
+// ----------------------------------------------------------------------------
+
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an empty tree whose keys are
+// sorted in the given order.
+//
+// Post: An empty tree exists.
+//
+// Parameter: order, which is the order of the keys in this tree.
+PersistentBinTree::PersistentBinTree(const BinTree::KeyOrder& order) :
+root(nullptr), order(order), size(0)
+{
+
+} // end of the default constructor
+
+// ------------------------------Copy Constructor------------------------------
+// Description: The copy constructor creates a tree that shares every tree
+// node with the given one. It takes O(1) time.
+//
+// Post: A new tree with the same strings as the given tree exists. Inserts
+// into either tree do not change the other.
+//
+// Parameter: other, which is the tree to copy.
+PersistentBinTree::PersistentBinTree(const PersistentBinTree& other) :
+root(other.root), order(other.order), size(other.size)
+{
+    retain(root);
+} // end of the copy constructor
+
+// ------------------------------Destructor------------------------------------
+// Description: The destructor lets go of the root node, freeing the tree
+// nodes that no other tree shares.
+//
+// Post: This tree does not exist.
+PersistentBinTree::~PersistentBinTree()
+{
+    release(root);
+} // end of the destructor
+
+// -------------------------------operator =-----------------------------------
+// Description: The operator = makes this tree share every tree node with the
+// given one. It takes O(1) time besides freeing the nodes that only this tree
+// held.
+//
+// Post: This tree has the same strings and key order as the given tree.
+//
+// Parameter: rhs, the tree to assign to this one.
+//
+// Return: A reference to this tree.
+PersistentBinTree& PersistentBinTree::operator=(const PersistentBinTree& rhs)
+{
+    // Holding the new root first makes self-assignment safe.
+    retain(rhs.root);
+    release(root);
+    root = rhs.root;
+    order = rhs.order;
+    size = rhs.size;
+    return *this;
+} // end of the method operator =
+
+// -------------------------------snapshot-------------------------------------
+// Description: The method snapshot returns a copy of this tree that later
+// inserts into this tree do not change. It takes O(1) time.
+//
+// Return: The snapshot.
+PersistentBinTree PersistentBinTree::snapshot() const
+{
+    return *this;
+} // end of the method snapshot
+
+// --------------------------------insert--------------------------------------
+// Description: The method insert adds a node data object with the given
+// string to this tree. It builds new copies of the tree nodes on the search
+// path and rebalances the copies, and it shares every other node with the
+// version before.
+//
+// Post: This tree contains the string. Other trees that shared nodes with
+// this one do not change.
+//
+// Parameter: value, the string to insert.
+//
+// Return: True if this method added the string; false if it was already in
+// this tree.
+bool PersistentBinTree::insert(const std::string& value)
+{
+    // Search first, so that a duplicate builds nothing.
+    const NodeData* found = nullptr;
+    if (retrieve(value, found))
+    {
+        return false;
+    }
+
+    Node* leaf = new Node;
+    leaf -> summary = order.summarize(value);
+    leaf -> data = std::make_shared<const NodeData>(value);
+    leaf -> left = nullptr;
+    leaf -> right = nullptr;
+    leaf -> height = 1;
+    leaf -> references.store(0, std::memory_order_relaxed);
+
+    const Node* newRoot = insertHelper(root, leaf);
+    retain(newRoot);
+    release(root);
+    root = newRoot;
+    size++;
+    return true;
+} // end of the method insert
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method finds the node data object with the given
+// string.
+//
+// Post: The given pointer will point to the node data object if the string
+// is in this tree; it stays valid while this tree or any copy holding it
+// exists. Otherwise, the given pointer does not change.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Parameter: pointer, which will point to the node data object found.
+//
+// Return: True if this method found the string, false otherwise.
+bool PersistentBinTree::retrieve(std::string_view key, const NodeData*& pointer) const
+{
+    unsigned long long summary = order.summarize(key);
+    const Node* current = root;
+    while (current != nullptr)
+    {
+        int comparison = compareKey(key, summary, current);
+        if (comparison < 0)
+        {
+            current = current -> left;
+        }
+        else if (comparison > 0)
+        {
+            current = current -> right;
+        }
+        else
+        {
+            pointer = current -> data.get();
+            return true;
+        }
+    }
+    return false;
+} // end of the method retrieve
+
+// -------------------------------isEmpty--------------------------------------
+// Description: The method isEmpty reports whether this tree is empty.
+//
+// Return: True if this tree has no strings; false otherwise.
+bool PersistentBinTree::isEmpty() const
+{
+    return root == nullptr;
+} // end of the method isEmpty
+
+// -------------------------------makeEmpty------------------------------------
+// Description: The method makeEmpty lets go of every tree node, so this tree
+// becomes empty. Copies of this tree do not change.
+//
+// Post: This tree is empty.
+void PersistentBinTree::makeEmpty()
+{
+    release(root);
+    root = nullptr;
+    size = 0;
+} // end of the method makeEmpty
+
+// --------------------------------getSize-------------------------------------
+// Description: The method getSize reports the number of strings in this tree.
+//
+// Return: The number of strings.
+int PersistentBinTree::getSize() const
+{
+    return size;
+} // end of the method getSize
+
+// -------------------------------getHeight------------------------------------
+// Description: The method getHeight reports the height of this tree.
+//
+// Return: The height; zero for an empty tree.
+int PersistentBinTree::getHeight() const
+{
+    return heightOf(root);
+} // end of the method getHeight
+
+// -------------------------------compareKey-----------------------------------
+// Description: The method compareKey orders the given string and the one in
+// the given tree node, comparing the summaries first.
+//
+// Parameter: target, which is the string to compare.
+//
+// Parameter: summary, which is the summary of the given string.
+//
+// Parameter: node, which is the tree node to compare with.
+//
+// Return: A negative number if the given string comes first, zero if the
+// strings are equal, and a positive number otherwise.
+int PersistentBinTree::compareKey(std::string_view target, unsigned long long summary,
+                                  const Node* node) const
+{
+    if (summary != node -> summary)
+    {
+        return (summary < node -> summary) ? -1 : 1;
+    }
+    return order.compare(target, node -> data -> getData());
+} // end of the method compareKey
+
+// -------------------------------heightOf-------------------------------------
+// Description: The method heightOf returns the height of the given subtree.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Return: The height; zero for a null pointer.
+int PersistentBinTree::heightOf(const Node* node)
+{
+    return (node == nullptr) ? 0 : node -> height;
+} // end of the method heightOf
+
+// --------------------------------makeNode------------------------------------
+// Description: The method makeNode builds a tree node with the key of the
+// given node and the given children, which it holds a reference to. The new
+// node itself has no references yet.
+//
+// Parameter: source, which is the tree node whose key the new node takes.
+//
+// Parameter: left, which is the left child.
+//
+// Parameter: right, which is the right child.
+//
+// Return: The new tree node.
+const PersistentBinTree::Node* PersistentBinTree::makeNode(const Node* source, const Node* left,
+                                                           const Node* right)
+{
+    Node* node = new Node;
+    node -> summary = source -> summary;
+    node -> data = source -> data;
+    node -> left = left;
+    node -> right = right;
+    int leftHeight = heightOf(left);
+    int rightHeight = heightOf(right);
+    node -> height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+    node -> references.store(0, std::memory_order_relaxed);
+    retain(left);
+    retain(right);
+    return node;
+} // end of the method makeNode
+
+// ---------------------------------retain-------------------------------------
+// Description: The method retain adds a reference to the given tree node.
+//
+// Parameter: node, which is the tree node; it may be a null pointer.
+void PersistentBinTree::retain(const Node* node)
+{
+    if (node != nullptr)
+    {
+        node -> references.fetch_add(1, std::memory_order_relaxed);
+    }
+} // end of the method retain
+
+// --------------------------------release-------------------------------------
+// Description: The method release removes a reference to the given tree node
+// and frees the node, and the children it alone held, when none is left.
+//
+// Parameter: node, which is the tree node; it may be a null pointer.
+void PersistentBinTree::release(const Node* node)
+{
+    // The thread that drops the last reference must see every write that the
+    // other holders made before they let go, as with std::shared_ptr.
+    if (node != nullptr && node -> references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        release(node -> left);
+        release(node -> right);
+        delete node;
+    }
+} // end of the method release
+
+// ---------------------------------discard------------------------------------
+// Description: The method discard frees the given tree node if nothing holds
+// a reference to it, which is the case for a copy that a rotation replaced.
+//
+// Parameter: node, which is the tree node.
+void PersistentBinTree::discard(const Node* node)
+{
+    retain(node);
+    release(node);
+} // end of the method discard
+
+// --------------------------------balance-------------------------------------
+// Description: The method balance builds the tree node that takes the place
+// of the given node with the given new children, rotating when the children
+// differ in height by two.
+//
+// Parameter: source, which is the tree node whose key the new subtree root
+// keeps when there is no rotation.
+//
+// Parameter: left, which is the new left child.
+//
+// Parameter: right, which is the new right child.
+//
+// Return: The root node of the new subtree, which has no references yet.
+const PersistentBinTree::Node* PersistentBinTree::balance(const Node* source, const Node* left,
+                                                          const Node* right)
+{
+    // The rotations build the moved nodes afresh, so the copy of the taller
+    // child that the recursion just built is discarded afterwards.
+    const Node* raised;
+    if (heightOf(left) - heightOf(right) > 1)
+    {
+        const Node* outer = left -> left;
+        const Node* inner = left -> right;
+        if (heightOf(outer) >= heightOf(inner))
+        {
+            raised = makeNode(left, outer, makeNode(source, inner, right));
+        }
+        else
+        {
+            raised = makeNode(inner, makeNode(left, outer, inner -> left),
+                              makeNode(source, inner -> right, right));
+        }
+        discard(left);
+    }
+    else if (heightOf(right) - heightOf(left) > 1)
+    {
+        const Node* outer = right -> right;
+        const Node* inner = right -> left;
+        if (heightOf(outer) >= heightOf(inner))
+        {
+            raised = makeNode(right, makeNode(source, left, inner), outer);
+        }
+        else
+        {
+            raised = makeNode(inner, makeNode(source, left, inner -> left),
+                              makeNode(right, inner -> right, outer));
+        }
+        discard(right);
+    }
+    else
+    {
+        raised = makeNode(source, left, right);
+    }
+    return raised;
+} // end of the method balance
+
+// ------------------------------insertHelper----------------------------------
+// Description: The method insertHelper builds the new version of the given
+// subtree with the given leaf added.
+//
+// Parameter: node, which is the root node of the subtree.
+//
+// Parameter: leaf, which is the new tree node.
+//
+// Return: The root node of the new version; a null pointer if the string of
+// the leaf is already in the subtree.
+const PersistentBinTree::Node* PersistentBinTree::insertHelper(const Node* node,
+                                                               const Node* leaf) const
+{
+    if (node == nullptr)
+    {
+        return leaf;
+    }
+
+    // The recursion is as deep as the tree, which AVL balance keeps short.
+    int comparison = compareKey(leaf -> data -> getData(), leaf -> summary, node);
+    if (comparison < 0)
+    {
+        const Node* left = insertHelper(node -> left, leaf);
+        return (left == nullptr) ? nullptr : balance(node, left, node -> right);
+    }
+    if (comparison > 0)
+    {
+        const Node* right = insertHelper(node -> right, leaf);
+        return (right == nullptr) ? nullptr : balance(node, node -> left, right);
+    }
+    return nullptr;
+} // end of the method insertHelper
\ No newline at end of file
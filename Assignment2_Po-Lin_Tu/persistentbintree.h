@@ -0,0 +1,273 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "bintree.h"
+#include "nodedata.h"
+
+// ----------------------------- persistentbintree.h ------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the PersistentBinTree class, a binary
+// search tree of strings whose tree nodes never change once they are built.
+// Copying a tree or taking a snapshot shares the root node and takes O(1) time
+// and memory. Insert copies only the nodes on the path from the root to the new
+// leaf, plus the ones a rotation moves, so it costs O(log n) new nodes while
+// every other copy of the tree keeps the version it had. The tree is kept
+// balanced as an AVL tree.
+//
+// Note: Every tree node counts the trees and tree nodes that point to it and is
+// freed when the count drops to zero, so a node shared by many snapshots lives
+// until the last of them lets it go. The node data objects are shared in the
+// same way between a node and its copies, so insert copies no strings. The
+// counts are atomic, so snapshots of one tree may be used and destroyed on
+// different threads, but one PersistentBinTree object must not be changed by
+// one thread while another uses it.
+// --------------------------------------------------------------------------------
+
+class PersistentBinTree
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates an empty tree whose keys are
+    // sorted in the given order.
+    //
+    // Post: An empty tree exists.
+    //
+    // Parameter: order, which is the order of the keys in this tree.
+    explicit PersistentBinTree(const BinTree::KeyOrder& order = BinTree::LEXICAL_ORDER);
+
+    // ------------------------------Copy Constructor------------------------------
+    // Description: The copy constructor creates a tree that shares every tree
+    // node with the given one. It takes O(1) time.
+    //
+    // Post: A new tree with the same strings as the given tree exists. Inserts
+    // into either tree do not change the other.
+    //
+    // Parameter: other, which is the tree to copy.
+    PersistentBinTree(const PersistentBinTree& other);
+
+    // ------------------------------Destructor------------------------------------
+    // Description: The destructor lets go of the root node, freeing the tree
+    // nodes that no other tree shares.
+    //
+    // Post: This tree does not exist.
+    ~PersistentBinTree();
+
+    // -------------------------------operator =-----------------------------------
+    // Description: The operator = makes this tree share every tree node with the
+    // given one. It takes O(1) time besides freeing the nodes that only this tree
+    // held.
+    //
+    // Post: This tree has the same strings and key order as the given tree.
+    //
+    // Parameter: rhs, the tree to assign to this one.
+    //
+    // Return: A reference to this tree.
+    PersistentBinTree& operator=(const PersistentBinTree& rhs);
+
+    // -------------------------------snapshot-------------------------------------
+    // Description: The method snapshot returns a copy of this tree that later
+    // inserts into this tree do not change. It takes O(1) time.
+    //
+    // Return: The snapshot.
+    PersistentBinTree snapshot() const;
+
+    // --------------------------------insert--------------------------------------
+    // Description: The method insert adds a node data object with the given
+    // string to this tree. It builds new copies of the tree nodes on the search
+    // path and rebalances the copies, and it shares every other node with the
+    // version before.
+    //
+    // Post: This tree contains the string. Other trees that shared nodes with
+    // this one do not change.
+    //
+    // Parameter: value, the string to insert.
+    //
+    // Return: True if this method added the string; false if it was already in
+    // this tree.
+    bool insert(const std::string& value);
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method finds the node data object with the given
+    // string.
+    //
+    // Post: The given pointer will point to the node data object if the string
+    // is in this tree; it stays valid while this tree or any copy holding it
+    // exists. Otherwise, the given pointer does not change.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Parameter: pointer, which will point to the node data object found.
+    //
+    // Return: True if this method found the string, false otherwise.
+    bool retrieve(std::string_view key, const NodeData*& pointer) const;
+
+    // -------------------------------isEmpty--------------------------------------
+    // Description: The method isEmpty reports whether this tree is empty.
+    //
+    // Return: True if this tree has no strings; false otherwise.
+    bool isEmpty() const;
+
+    // -------------------------------makeEmpty------------------------------------
+    // Description: The method makeEmpty lets go of every tree node, so this tree
+    // becomes empty. Copies of this tree do not change.
+    //
+    // Post: This tree is empty.
+    void makeEmpty();
+
+    // --------------------------------getSize-------------------------------------
+    // Description: The method getSize reports the number of strings in this tree.
+    //
+    // Return: The number of strings.
+    int getSize() const;
+
+    // -------------------------------getHeight------------------------------------
+    // Description: The method getHeight reports the height of this tree.
+    //
+    // Return: The height; zero for an empty tree.
+    int getHeight() const;
+
+    // -------------------------------forEach--------------------------------------
+    // Description: The method forEach passes every node data object in this tree
+    // to the given function in the key order.
+    //
+    // Parameter: visit, which is called as visit(data) with a constant
+    // reference to each node data object.
+    template <class Visit>
+    void forEach(Visit visit) const;
+
+private:
+    // A tree node, which does not change after it is built. A node has no
+    // parent pointer, since it may have a different parent in each version.
+    struct Node
+    {
+        unsigned long long summary;
+        std::shared_ptr<const NodeData> data;
+        const Node* left;
+        const Node* right;
+        int height;
+        mutable std::atomic<int> references;
+    };
+
+    // The deepest path an AVL tree can have for any tree that fits in memory.
+    static const int MAX_HEIGHT = 96;
+
+    const Node* root;
+    BinTree::KeyOrder order;
+    int size;
+
+    // -------------------------------compareKey-----------------------------------
+    // Description: The method compareKey orders the given string and the one in
+    // the given tree node, comparing the summaries first.
+    //
+    // Parameter: target, which is the string to compare.
+    //
+    // Parameter: summary, which is the summary of the given string.
+    //
+    // Parameter: node, which is the tree node to compare with.
+    //
+    // Return: A negative number if the given string comes first, zero if the
+    // strings are equal, and a positive number otherwise.
+    int compareKey(std::string_view target, unsigned long long summary, const Node* node) const;
+
+    // -------------------------------heightOf-------------------------------------
+    // Description: The method heightOf returns the height of the given subtree.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Return: The height; zero for a null pointer.
+    static int heightOf(const Node* node);
+
+    // --------------------------------makeNode------------------------------------
+    // Description: The method makeNode builds a tree node with the key of the
+    // given node and the given children, which it holds a reference to. The new
+    // node itself has no references yet.
+    //
+    // Parameter: source, which is the tree node whose key the new node takes.
+    //
+    // Parameter: left, which is the left child.
+    //
+    // Parameter: right, which is the right child.
+    //
+    // Return: The new tree node.
+    static const Node* makeNode(const Node* source, const Node* left, const Node* right);
+
+    // ---------------------------------retain-------------------------------------
+    // Description: The method retain adds a reference to the given tree node.
+    //
+    // Parameter: node, which is the tree node; it may be a null pointer.
+    static void retain(const Node* node);
+
+    // --------------------------------release-------------------------------------
+    // Description: The method release removes a reference to the given tree node
+    // and frees the node, and the children it alone held, when none is left.
+    //
+    // Parameter: node, which is the tree node; it may be a null pointer.
+    static void release(const Node* node);
+
+    // ---------------------------------discard------------------------------------
+    // Description: The method discard frees the given tree node if nothing holds
+    // a reference to it, which is the case for a copy that a rotation replaced.
+    //
+    // Parameter: node, which is the tree node.
+    static void discard(const Node* node);
+
+    // --------------------------------balance-------------------------------------
+    // Description: The method balance builds the tree node that takes the place
+    // of the given node with the given new children, rotating when the children
+    // differ in height by two.
+    //
+    // Parameter: source, which is the tree node whose key the new subtree root
+    // keeps when there is no rotation.
+    //
+    // Parameter: left, which is the new left child.
+    //
+    // Parameter: right, which is the new right child.
+    //
+    // Return: The root node of the new subtree, which has no references yet.
+    static const Node* balance(const Node* source, const Node* left, const Node* right);
+
+    // ------------------------------insertHelper----------------------------------
+    // Description: The method insertHelper builds the new version of the given
+    // subtree with the given leaf added.
+    //
+    // Parameter: node, which is the root node of the subtree.
+    //
+    // Parameter: leaf, which is the new tree node.
+    //
+    // Return: The root node of the new version; a null pointer if the string of
+    // the leaf is already in the subtree.
+    const Node* insertHelper(const Node* node, const Node* leaf) const;
+};
+
+// -------------------------------forEach--------------------------------------
+// Description: The method forEach passes every node data object in this tree
+// to the given function in the key order.
+//
+// Parameter: visit, which is called as visit(data) with a constant
+// reference to each node data object.
+template <class Visit>
+void PersistentBinTree::forEach(Visit visit) const
+{
+    // The nodes have no parent pointers, so the path is kept on a stack,
+    // which the AVL height keeps short.
+    const Node* pending[MAX_HEIGHT];
+    int depth = 0;
+    const Node* current = root;
+    while (current != nullptr || depth > 0)
+    {
+        while (current != nullptr)
+        {
+            pending[depth++] = current;
+            current = current -> left;
+        }
+        current = pending[--depth];
+        visit(static_cast<const NodeData&>(*(current -> data)));
+        current = current -> right;
+    }
+} // end of the method forEach
\ No newline at end of file
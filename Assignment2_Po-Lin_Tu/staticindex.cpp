@@ -0,0 +1,185 @@
+#include "staticindex.h"
+
+// ------------------------------ staticindex.cpp -----------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the StaticIndex class, a
+// read-only copy of the strings of a binary search tree in Eytzinger order.
+// ----------------------------------------------------------------------------
+
+// ---------------------------------prefetch-----------------------------------
+// Description: The function prefetch asks the processor to start loading the
+// cache line at the given address. Compilers without the builtin skip it.
+static void prefetch(const void* address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+} // end of the function prefetch
+
+// ---------------------------Default Constructor------------------------------
+// Description: The default constructor creates an empty index.
+//
+// Post: An index that holds no strings exists.
+StaticIndex::StaticIndex() : StaticIndex(BinTree::LEXICAL_ORDER, {})
+{
+
+} // end of the default constructor
+
+// ------------------------------Constructor-----------------------------------
+// Description: The constructor creates an index of the given strings.
+//
+// Pre: The strings should be sorted in the given order without repeats.
+//
+// Post: An index that holds copies of the strings exists.
+//
+// Parameter: order, which is the order of the strings.
+//
+// Parameter: keys, which are the sorted strings.
+StaticIndex::StaticIndex(const BinTree::KeyOrder& order,
+                         const std::vector<std::string_view>& keys) :
+order(order), count(keys.size()), lines(keys.size() / LINE_SIZE + 1), sharedLength(0)
+{
+    // In the lexical order, the strings between the first and the last share
+    // the bytes that those two share, and the bytes after them keep the order.
+    if (count > 1 && order.summarize == BinTree::LEXICAL_ORDER.summarize)
+    {
+        std::string_view low = keys.front();
+        std::string_view high = keys.back();
+        while (sharedLength < low.size() && sharedLength < high.size() &&
+               low[sharedLength] == high[sharedLength])
+        {
+            sharedLength++;
+        }
+    }
+
+    std::vector<std::string_view> placed(count + 1);
+    size_t next = 0;
+    fillHelper(keys, next, 1, placed);
+
+    size_t total = 0;
+    for (size_t index = 0; index < keys.size(); index++)
+    {
+        total += keys[index].size();
+    }
+    bytes.reserve(total);
+    starts.reserve(count + 2);
+    starts.push_back(0);
+    for (size_t position = 1; position <= count; position++)
+    {
+        starts.push_back(bytes.size());
+        bytes.append(placed[position]);
+        lines[position / LINE_SIZE].summaries[position % LINE_SIZE] =
+            order.summarize(placed[position].substr(sharedLength));
+    }
+    starts.push_back(bytes.size());
+} // end of the constructor
+
+// --------------------------------retrieve------------------------------------
+// Description: The retrieve method reports whether the given string is in
+// this index. It reads about log n summaries and compares whole strings only
+// where the summaries tie and once at the end.
+//
+// Parameter: key, which is the string to retrieve.
+//
+// Return: True if the string is in this index; false otherwise.
+bool StaticIndex::retrieve(std::string_view key) const
+{
+    // Every string in this index starts with the shared bytes, including the
+    // one at position one, which starts at the front of the bytes.
+    if (key.compare(0, sharedLength, bytes.data(), sharedLength) != 0)
+    {
+        return false;
+    }
+    unsigned long long summary = order.summarize(key.substr(sharedLength));
+    const Line* line = lines.data();
+    size_t lastLine = lines.size() - 1;
+
+    // The walk goes right past every string that comes before the given one,
+    // adding the outcome of the comparison to the position instead of
+    // branching on it. Line k holds the children of the children of the
+    // children of position k, which are read three steps later.
+    size_t position = 1;
+    while (position <= count)
+    {
+        prefetch(line + (position < lastLine ? position : lastLine));
+        unsigned long long value = line[position / LINE_SIZE].summaries[position % LINE_SIZE];
+        size_t before = (value < summary);
+        if (value == summary)
+        {
+            before = (order.compare(keyAt(position), key) < 0);
+        }
+        position = 2 * position + before;
+    }
+
+    // Dropping the right turns at the end of the walk and the left turn before
+    // them leads to the first string that does not come before the given one.
+    while ((position & 1) != 0)
+    {
+        position >>= 1;
+    }
+    position >>= 1;
+    return position != 0 &&
+           line[position / LINE_SIZE].summaries[position % LINE_SIZE] == summary &&
+           order.compare(keyAt(position), key) == 0;
+} // end of the method retrieve
+
+// --------------------------------isEmpty-------------------------------------
+// Description: The method isEmpty reports whether this index is empty.
+//
+// Return: True if this index has no strings; false otherwise.
+bool StaticIndex::isEmpty() const
+{
+    return count == 0;
+} // end of the method isEmpty
+
+// --------------------------------getSize-------------------------------------
+// Description: The method getSize reports the number of strings in this
+// index.
+//
+// Return: The number of strings.
+int StaticIndex::getSize() const
+{
+    return static_cast<int>(count);
+} // end of the method getSize
+
+// ---------------------------------keyAt--------------------------------------
+// Description: The method keyAt returns the string at the given position.
+//
+// Parameter: position, which is the position in Eytzinger order.
+//
+// Return: The string.
+std::string_view StaticIndex::keyAt(size_t position) const
+{
+    return std::string_view(bytes.data() + starts[position],
+                            starts[position + 1] - starts[position]);
+} // end of the method keyAt
+
+// -------------------------------fillHelper-----------------------------------
+// Description: The method fillHelper places the given sorted strings, in
+// order, at the positions of the subtree of the given position.
+//
+// Parameter: keys, which are the sorted strings.
+//
+// Parameter: next, which is the position in the strings of the next one to
+// place.
+//
+// Parameter: position, which is the root position of the subtree.
+//
+// Parameter: placed, which receives the string of each position.
+void StaticIndex::fillHelper(const std::vector<std::string_view>& keys, size_t& next,
+                             size_t position, std::vector<std::string_view>& placed)
+{
+    // An in-order walk of the implicit tree meets the positions in key order.
+    if (position > count)
+    {
+        return;
+    }
+    fillHelper(keys, next, 2 * position, placed);
+    placed[position] = keys[next++];
+    fillHelper(keys, next, 2 * position + 1, placed);
+} // end of the method fillHelper
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bintree.h"
+
+// --------------------------------- staticindex.h --------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the StaticIndex class, a read-only
+// copy of the strings of a binary search tree that BinTree::toStaticIndex
+// builds. The strings are stored in Eytzinger order: the string at position k
+// has its children at positions 2k and 2k + 1, so a search walks one array from
+// front to back instead of following pointers. The summaries of the strings,
+// which for the lexical order are the first eight bytes after those that every
+// string shares, sit in an array of their own, aligned to cache lines, so that
+// the eight positions three levels below any position share one cache line.
+//
+// Note: A search reads only the summaries and picks the child with arithmetic
+// rather than a branch, prefetching the line three levels ahead, and calls the
+// compare function of the key order only when two summaries tie. Later changes
+// to the tree do not show up in the index.
+// --------------------------------------------------------------------------------
+
+class StaticIndex
+{
+public:
+    // ---------------------------Default Constructor------------------------------
+    // Description: The default constructor creates an empty index.
+    //
+    // Post: An index that holds no strings exists.
+    StaticIndex();
+
+    // ------------------------------Constructor-----------------------------------
+    // Description: The constructor creates an index of the given strings.
+    //
+    // Pre: The strings should be sorted in the given order without repeats.
+    //
+    // Post: An index that holds copies of the strings exists.
+    //
+    // Parameter: order, which is the order of the strings.
+    //
+    // Parameter: keys, which are the sorted strings.
+    StaticIndex(const BinTree::KeyOrder& order, const std::vector<std::string_view>& keys);
+
+    // --------------------------------retrieve------------------------------------
+    // Description: The retrieve method reports whether the given string is in
+    // this index. It reads about log n summaries and compares whole strings only
+    // where the summaries tie and once at the end.
+    //
+    // Parameter: key, which is the string to retrieve.
+    //
+    // Return: True if the string is in this index; false otherwise.
+    bool retrieve(std::string_view key) const;
+
+    // --------------------------------isEmpty-------------------------------------
+    // Description: The method isEmpty reports whether this index is empty.
+    //
+    // Return: True if this index has no strings; false otherwise.
+    bool isEmpty() const;
+
+    // --------------------------------getSize-------------------------------------
+    // Description: The method getSize reports the number of strings in this
+    // index.
+    //
+    // Return: The number of strings.
+    int getSize() const;
+
+private:
+    // The number of summaries in one cache line.
+    static const size_t LINE_SIZE = 8;
+
+    // One cache line of summaries. Position zero, which is unused, is the first
+    // summary of the first line, so positions 8k to 8k + 7 fill line k.
+    struct alignas(64) Line
+    {
+        unsigned long long summaries[LINE_SIZE];
+    };
+
+    BinTree::KeyOrder order;
+    size_t count;
+    std::vector<Line> lines;
+
+    // The number of leading bytes that every string shares, which are left out
+    // of the summaries in the lexical order; zero in the other orders.
+    size_t sharedLength;
+
+    // The bytes of the string at position k lie from starts[k] up to
+    // starts[k + 1] in bytes.
+    std::string bytes;
+    std::vector<size_t> starts;
+
+    // ---------------------------------keyAt--------------------------------------
+    // Description: The method keyAt returns the string at the given position.
+    //
+    // Parameter: position, which is the position in Eytzinger order.
+    //
+    // Return: The string.
+    std::string_view keyAt(size_t position) const;
+
+    // -------------------------------fillHelper-----------------------------------
+    // Description: The method fillHelper places the given sorted strings, in
+    // order, at the positions of the subtree of the given position.
+    //
+    // Parameter: keys, which are the sorted strings.
+    //
+    // Parameter: next, which is the position in the strings of the next one to
+    // place.
+    //
+    // Parameter: position, which is the root position of the subtree.
+    //
+    // Parameter: placed, which receives the string of each position.
+    void fillHelper(const std::vector<std::string_view>& keys, size_t& next, size_t position,
+                    std::vector<std::string_view>& placed);
+};
\ No newline at end of file
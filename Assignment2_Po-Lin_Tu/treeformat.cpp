@@ -0,0 +1,198 @@
+#include <cstring>
+#include "treeformat.h"
+
+// ----------------------------- treeformat.cpp -------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the implementation file of the TreeFormat class that
+// reads and writes the pieces of a binary image of a binary search tree.
+// ----------------------------------------------------------------------------
+
+const char TreeFormat::MAGIC[8] = {'B', 'I', 'N', 'T', 'R', 'E', 'E', '1'};
+
+// ------------------------------putHeader-------------------------------------
+// Description: The method putHeader appends a header to the given image.
+//
+// Parameter: image, which is the image to append to.
+//
+// Parameter: count, which is the number of strings.
+//
+// Parameter: restartInterval, which is the number of records per restart.
+void TreeFormat::putHeader(std::string& image, unsigned long long count, unsigned restartInterval)
+{
+    image.append(MAGIC, sizeof(MAGIC));
+    putFixed64(image, count);
+
+    // The restart interval and the zero bits after it fill one 64-bit slot.
+    putFixed64(image, restartInterval);
+} // end of the method putHeader
+
+// ------------------------------putRecord-------------------------------------
+// Description: The method putRecord appends the record of the given string
+// to the given image, sharing the leading bytes it has in common with the
+// string before unless the record is a restart.
+//
+// Parameter: image, which is the image to append to.
+//
+// Parameter: previous, which is the string before; it is ignored for a
+// restart.
+//
+// Parameter: key, which is the string to append.
+//
+// Parameter: restart, which is whether the record shares no bytes.
+void TreeFormat::putRecord(std::string& image, std::string_view previous, std::string_view key,
+                           bool restart)
+{
+    size_t shared = 0;
+    if (!restart)
+    {
+        size_t limit = (previous.size() < key.size()) ? previous.size() : key.size();
+        while (shared < limit && previous[shared] == key[shared])
+        {
+            shared++;
+        }
+    }
+    putVarint(image, shared);
+    putVarint(image, key.size() - shared);
+    image.append(key.data() + shared, key.size() - shared);
+} // end of the method putRecord
+
+// ------------------------------putFixed64------------------------------------
+// Description: The method putFixed64 appends the given number to the given
+// image as eight bytes.
+//
+// Parameter: image, which is the image to append to.
+//
+// Parameter: value, which is the number.
+void TreeFormat::putFixed64(std::string& image, unsigned long long value)
+{
+    for (int index = 0; index < 8; index++)
+    {
+        image.push_back(static_cast<char>((value >> (8 * index)) & 0xff));
+    }
+} // end of the method putFixed64
+
+// ------------------------------putVarint-------------------------------------
+// Description: The method putVarint appends the given number to the given
+// image as a varint.
+//
+// Parameter: image, which is the image to append to.
+//
+// Parameter: value, which is the number.
+void TreeFormat::putVarint(std::string& image, unsigned long long value)
+{
+    while (value >= 0x80)
+    {
+        image.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    image.push_back(static_cast<char>(value));
+} // end of the method putVarint
+
+// ------------------------------getHeader-------------------------------------
+// Description: The method getHeader reads the header at the start of the
+// given bytes.
+//
+// Parameter: bytes, which is the start of the image.
+//
+// Parameter: size, which is the number of bytes available.
+//
+// Parameter: count, which receives the number of strings.
+//
+// Parameter: restartInterval, which receives the number of records per
+// restart.
+//
+// Return: True if the bytes start with a valid header; false otherwise.
+bool TreeFormat::getHeader(const unsigned char* bytes, size_t size, unsigned long long& count,
+                           unsigned& restartInterval)
+{
+    if (size < HEADER_SIZE || std::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        return false;
+    }
+    count = getFixed64(bytes + 8);
+    unsigned long long interval = getFixed64(bytes + 16);
+    if (interval == 0 || interval > 0xffffffffULL)
+    {
+        return false;
+    }
+    restartInterval = static_cast<unsigned>(interval);
+    return true;
+} // end of the method getHeader
+
+// ------------------------------getRecord-------------------------------------
+// Description: The method getRecord reads the record at the given position
+// and turns the given string, which holds the string before, into the one
+// in the record.
+//
+// Post: The position is just after the record if this method succeeded.
+//
+// Parameter: cursor, which is the position of the record.
+//
+// Parameter: end, which is just after the last byte that may be read.
+//
+// Parameter: key, which holds the string before and receives the string in
+// the record.
+//
+// Return: True if a valid record was read; false otherwise.
+bool TreeFormat::getRecord(const unsigned char*& cursor, const unsigned char* end, std::string& key)
+{
+    const unsigned char* position = cursor;
+    unsigned long long shared = 0;
+    unsigned long long length = 0;
+    if (!getVarint(position, end, shared) || !getVarint(position, end, length) ||
+        shared > key.size() || length > static_cast<unsigned long long>(end - position))
+    {
+        return false;
+    }
+    key.resize(shared);
+    key.append(reinterpret_cast<const char*>(position), length);
+    cursor = position + length;
+    return true;
+} // end of the method getRecord
+
+// -------------------------------getVarint------------------------------------
+// Description: The method getVarint reads a varint at the given position.
+//
+// Post: The position is just after the varint if this method succeeded.
+//
+// Parameter: cursor, which is the position of the varint.
+//
+// Parameter: end, which is just after the last byte that may be read.
+//
+// Parameter: value, which receives the number.
+//
+// Return: True if a valid varint was read; false otherwise.
+bool TreeFormat::getVarint(const unsigned char*& cursor, const unsigned char* end,
+                           unsigned long long& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64 && cursor != end; shift += 7)
+    {
+        unsigned char byte = *cursor++;
+        value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+} // end of the method getVarint
+
+// ------------------------------getFixed64------------------------------------
+// Description: The method getFixed64 reads a number stored as eight bytes.
+//
+// Parameter: bytes, which is the position of the number.
+//
+// Return: The number.
+unsigned long long TreeFormat::getFixed64(const unsigned char* bytes)
+{
+    unsigned long long value = 0;
+    for (int index = 7; index >= 0; index--)
+    {
+        value = (value << 8) | bytes[index];
+    }
+    return value;
+} // end of the method getFixed64
\ No newline at end of file
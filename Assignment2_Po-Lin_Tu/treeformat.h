@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// --------------------------------- treeformat.h ---------------------------------
+// Programmer Name: Po-Lin Tu     Course Section Number: CSS 343 B
+// Creation Date: 10/19/2026
+// Date of Last Modification: 10/19/2026
+//
+// Purpose: This file is the header file of the TreeFormat class, which reads and
+// writes the pieces of the binary image that BinTree::save writes, BinTree::load
+// reads and MappedBinTree searches in place. An image is laid out as follows,
+// with every fixed-width integer in little-endian byte order:
+//
+//     header:   the eight bytes of MAGIC, the number of strings as 64 bits, the
+//               restart interval as 32 bits and 32 zero bits
+//     records:  the strings in the key order, each as a varint of the number of
+//               leading bytes it shares with the string before, a varint of the
+//               number of bytes that follow, and those bytes
+//     restarts: the offset from the start of the image of every record that
+//               shares no bytes, as 64 bits each
+//     trailer:  the offset of the restart table as 64 bits and MAGIC again
+//
+// Note: Every restart interval strings, a record shares no bytes with the one
+// before, which is front coding with restart points: a string can be rebuilt
+// from the restart before it without decoding the whole image, and a binary
+// search over the restarts reads complete strings. A restart interval of one
+// turns front coding off. A varint stores seven bits per byte, low bits first,
+// with the high bit set on every byte but the last.
+// --------------------------------------------------------------------------------
+
+class TreeFormat
+{
+public:
+    // The bytes that start and end every image.
+    static const char MAGIC[8];
+
+    // The sizes of the header and the trailer in bytes.
+    static const size_t HEADER_SIZE = 24;
+    static const size_t TRAILER_SIZE = 16;
+
+    // The restart interval that save uses when front coding is on.
+    static const unsigned RESTART_INTERVAL = 16;
+
+    // ------------------------------putHeader-------------------------------------
+    // Description: The method putHeader appends a header to the given image.
+    //
+    // Parameter: image, which is the image to append to.
+    //
+    // Parameter: count, which is the number of strings.
+    //
+    // Parameter: restartInterval, which is the number of records per restart.
+    static void putHeader(std::string& image, unsigned long long count, unsigned restartInterval);
+
+    // ------------------------------putRecord-------------------------------------
+    // Description: The method putRecord appends the record of the given string
+    // to the given image, sharing the leading bytes it has in common with the
+    // string before unless the record is a restart.
+    //
+    // Parameter: image, which is the image to append to.
+    //
+    // Parameter: previous, which is the string before; it is ignored for a
+    // restart.
+    //
+    // Parameter: key, which is the string to append.
+    //
+    // Parameter: restart, which is whether the record shares no bytes.
+    static void putRecord(std::string& image, std::string_view previous, std::string_view key,
+                          bool restart);
+
+    // ------------------------------putFixed64------------------------------------
+    // Description: The method putFixed64 appends the given number to the given
+    // image as eight bytes.
+    //
+    // Parameter: image, which is the image to append to.
+    //
+    // Parameter: value, which is the number.
+    static void putFixed64(std::string& image, unsigned long long value);
+
+    // ------------------------------getHeader-------------------------------------
+    // Description: The method getHeader reads the header at the start of the
+    // given bytes.
+    //
+    // Parameter: bytes, which is the start of the image.
+    //
+    // Parameter: size, which is the number of bytes available.
+    //
+    // Parameter: count, which receives the number of strings.
+    //
+    // Parameter: restartInterval, which receives the number of records per
+    // restart.
+    //
+    // Return: True if the bytes start with a valid header; false otherwise.
+    static bool getHeader(const unsigned char* bytes, size_t size, unsigned long long& count,
+                          unsigned& restartInterval);
+
+    // ------------------------------getRecord-------------------------------------
+    // Description: The method getRecord reads the record at the given position
+    // and turns the given string, which holds the string before, into the one
+    // in the record.
+    //
+    // Post: The position is just after the record if this method succeeded.
+    //
+    // Parameter: cursor, which is the position of the record.
+    //
+    // Parameter: end, which is just after the last byte that may be read.
+    //
+    // Parameter: key, which holds the string before and receives the string in
+    // the record.
+    //
+    // Return: True if a valid record was read; false otherwise.
+    static bool getRecord(const unsigned char*& cursor, const unsigned char* end, std::string& key);
+
+    // -------------------------------getVarint------------------------------------
+    // Description: The method getVarint reads a varint at the given position.
+    //
+    // Post: The position is just after the varint if this method succeeded.
+    //
+    // Parameter: cursor, which is the position of the varint.
+    //
+    // Parameter: end, which is just after the last byte that may be read.
+    //
+    // Parameter: value, which receives the number.
+    //
+    // Return: True if a valid varint was read; false otherwise.
+    static bool getVarint(const unsigned char*& cursor, const unsigned char* end,
+                          unsigned long long& value);
+
+    // ------------------------------getFixed64------------------------------------
+    // Description: The method getFixed64 reads a number stored as eight bytes.
+    //
+    // Parameter: bytes, which is the position of the number.
+    //
+    // Return: The number.
+    static unsigned long long getFixed64(const unsigned char* bytes);
+
+private:
+    // ------------------------------putVarint-------------------------------------
+    // Description: The method putVarint appends the given number to the given
+    // image as a varint.
+    //
+    // Parameter: image, which is the image to append to.
+    //
+    // Parameter: value, which is the number.
+    static void putVarint(std::string& image, unsigned long long value);
+};
\ No newline at end of file
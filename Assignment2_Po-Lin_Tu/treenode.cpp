@@ -7,7 +7,9 @@
 //
 // Purpose: This file is the implementation file of the TreeNode class that 
 // defines the tree nodes in my binary search tree. A tree node have pointers
-// that point to the node data and its left and right children.
+// that point to the node data, its left and right children, and its parent.
+// A tree node caches an integer summary of its string for fast comparisons
+// and can hold its node data object in place.
 // ----------------------------------------------------------------------------
 
 
@@ -15,7 +17,10 @@
 // Description: The default constructor creates an empty tree node.
 //
 // Post: An empty tree node, whose pointers are all null pointers, exists.
-TreeNode::TreeNode() : data(nullptr), left(nullptr), right(nullptr)
+// Its height and size are one and its color is black.
+TreeNode::TreeNode() :
+summary(0), hash(0), data(nullptr), left(nullptr), right(nullptr), parent(nullptr), height(1), size(1),
+red(false), embedded(false)
 {
 
 } // end of the default constructor
@@ -25,6 +30,8 @@ TreeNode::TreeNode() : data(nullptr), left(nullptr), right(nullptr)
 // pointers are set to the parameters.
 //
 // Post: A new tree node, whose pointers are set to the parameters, exists.
+// Its parent is a null pointer, its height and size are one and its color
+// is black.
 //
 // Parameter: dataPtr, a pointer to the node data.
 //
@@ -33,22 +40,30 @@ TreeNode::TreeNode() : data(nullptr), left(nullptr), right(nullptr)
 // Parameter: rightPtr, a pointer to the tree node that should be the right
 // child.
 TreeNode::TreeNode(NodeData* dataPtr, TreeNode* leftPtr, TreeNode* rightPtr) : 
-data(dataPtr), left(leftPtr), right(rightPtr)
+summary(0), hash(0), data(dataPtr), left(leftPtr), right(rightPtr), parent(nullptr),
+height(1), size(1), red(false), embedded(false)
 {
 
 } // end of the parametrized constructor
 
 // ------------------------------Destructor------------------------------------
 // Description: The destructor deletes this tree node, freeing the memory that
-// was dynamically allocated to this tree node.
+// was dynamically allocated to this tree node, and destroys the node data
+// object stored in it.
 //
 // Post: This tree node does not exist, and the dynamically allocated memory
 // is free.
 TreeNode::~TreeNode()
 {
-    if (data != nullptr)
+    // The object stored in this node is destroyed even if the tree has handed
+    // out a copy and cleared the pointer.
+    if (embedded)
+    {
+        reinterpret_cast<NodeData*>(storage) -> ~NodeData();
+    }
+    else if (data != nullptr)
     {
         delete data;
-        data = nullptr;
     }
+    data = nullptr;
 } // end of the destructor
\ No newline at end of file
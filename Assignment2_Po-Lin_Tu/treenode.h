@@ -9,24 +9,52 @@
 //
 // Purpose: This file is the header file of the TreeNode class that defines the
 // tree nodes in my binary search tree. A tree node have pointers that point to the
-// node data and its left and right children.
+// node data, its left and right children, and its parent.
+//
+// Note: A tree node caches an integer summary of its string, such as its first
+// eight bytes, on the same cache line as its child pointers, so a search compares
+// two integers at most levels and reads the string only when they tie. A tree
+// node can also hold its node data object in place, so that string, when it is
+// short, is stored in the node itself instead of behind two more pointers.
 // --------------------------------------------------------------------------------
 
 
 class TreeNode
 {
 private:
+    // The summary of the node data object under the key order of the tree,
+    // and a hash of the strings and the shape of the subtree rooted at this
+    // node, so that two subtrees with different hashes are known to differ.
+    unsigned long long summary;
+    unsigned long long hash;
+
     NodeData* data;
     TreeNode* left;
     TreeNode* right;
+    TreeNode* parent;
+
+    // The height of the subtree rooted at this node, which is one for a leaf,
+    // the number of nodes in that subtree, and the color of this node. The
+    // BinTree class keeps the height and the size in every mode and the color
+    // in the red-black mode.
+    int height;
+    int size;
+    bool red;
+
+    // Whether the node data object is stored in this node rather than on the
+    // heap, and the room for it.
+    bool embedded;
+    alignas(NodeData) unsigned char storage[sizeof(NodeData)];
 
     friend class BinTree;
+    friend class NodePool;
 
 public:
     // ---------------------------Default Constructor------------------------------
     // Description: The default constructor creates an empty tree node.
     //
     // Post: An empty tree node, whose pointers are all null pointers, exists.
+    // Its height and size are one and its color is black.
     TreeNode();
 
     // ------------------------Parametrized Constructor----------------------------
@@ -34,6 +62,8 @@ public:
     // pointers are set to the parameters.
     //
     // Post: A new tree node, whose pointers are set to the parameters, exists.
+    // Its parent is a null pointer, its height and size are one and its color
+    // is black.
     //
     // Parameter: dataPtr, a pointer to the node data.
     //
@@ -45,7 +75,8 @@ public:
 
     // ------------------------------Destructor------------------------------------
     // Description: The destructor deletes this tree node, freeing the memory that
-    // was dynamically allocated to this tree node.
+    // was dynamically allocated to this tree node, and destroys the node data
+    // object stored in it.
     //
     // Post: This tree node does not exist, and the dynamically allocated memory
     // is free.